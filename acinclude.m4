@@ -19,6 +19,12 @@ AC_DEFUN([AX_LIBFCACHE_CHECK_LOCAL],
       [Missing function: time],
       [1])
     ])
+
+  dnl Headers included in libfcache/libfcache_sharded_cache.c
+  AC_CHECK_HEADERS([unistd.h])
+
+  dnl System functions used in libfcache/libfcache_sharded_cache.c
+  AC_CHECK_FUNCS([sysconf])
   ])
 
 dnl Function to check if DLL support is needed
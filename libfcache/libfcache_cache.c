@@ -25,9 +25,21 @@
 
 #include "libfcache_cache.h"
 #include "libfcache_cache_value.h"
+#include "libfcache_date_time.h"
 #include "libfcache_definitions.h"
+#include "libfcache_file_slots.h"
+#include "libfcache_flat_table.h"
+#include "libfcache_frequency_sketch.h"
+#include "libfcache_greedy_dual.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_hit_buffers.h"
 #include "libfcache_libcdata.h"
 #include "libfcache_libcerror.h"
+#include "libfcache_libcthreads.h"
+#include "libfcache_linear_table.h"
+#include "libfcache_pending_loads.h"
+#include "libfcache_policy.h"
+#include "libfcache_slot_queues.h"
 #include "libfcache_types.h"
 
 /* Creates a cache
@@ -38,9 +50,40 @@ int libfcache_cache_initialize(
      libfcache_cache_t **cache,
      int maximum_cache_entries,
      libcerror_error_t **error )
+{
+	static char *function = "libfcache_cache_initialize";
+
+	if( libfcache_cache_initialize_with_flags(
+	     cache,
+	     maximum_cache_entries,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a cache with specific flags
+ * Make sure the value cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_initialize_with_flags(
+     libfcache_cache_t **cache,
+     int maximum_cache_entries,
+     uint8_t flags,
+     libcerror_error_t **error )
 {
 	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_initialize";
+	static char *function                      = "libfcache_cache_initialize_with_flags";
+	uint8_t replacement_flags                  = 0;
 
 	if( cache == NULL )
 	{
@@ -75,6 +118,34 @@ int libfcache_cache_initialize(
 
 		return( -1 );
 	}
+	if( ( flags & ~( LIBFCACHE_CACHE_FLAG_FLAT_INDEX | LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT | LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT | LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION | LIBFCACHE_CACHE_FLAG_S3_FIFO_REPLACEMENT | LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT | LIBFCACHE_CACHE_FLAG_PREALLOCATE_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	replacement_flags = flags & ( LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT | LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT | LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION | LIBFCACHE_CACHE_FLAG_S3_FIFO_REPLACEMENT | LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT );
+
+	/* Only one of the replacement flags can be set
+	 */
+	if( ( replacement_flags & ( replacement_flags - 1 ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 " - multiple replacement policies.",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
 	internal_cache = memory_allocate_structure(
 	                  libfcache_internal_cache_t );
 
@@ -120,200 +191,7152 @@ int libfcache_cache_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( internal_cache->entries_list ),
+	if( libfcache_slot_queues_initialize(
+	     &( internal_cache->used_slots ),
+	     maximum_cache_entries,
+	     LIBFCACHE_CACHE_NUMBER_OF_QUEUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create entries list.",
+		 "%s: unable to create used slots.",
 		 function );
 
 		goto on_error;
 	}
-	*cache = (libfcache_cache_t *) internal_cache;
-
-	return( 1 );
+	if( libfcache_slot_queues_initialize(
+	     &( internal_cache->free_slots ),
+	     maximum_cache_entries,
+	     LIBFCACHE_CACHE_NUMBER_OF_QUEUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free slots.",
+		 function );
 
-on_error:
-	if( internal_cache != NULL )
+		goto on_error;
+	}
+	if( ( flags & LIBFCACHE_CACHE_FLAG_FLAT_INDEX ) != 0 )
 	{
-		if( internal_cache->entries_array != NULL )
+		if( libfcache_flat_table_initialize(
+		     &( internal_cache->flat_table ),
+		     maximum_cache_entries,
+		     error ) != 1 )
 		{
-			libcdata_array_free(
-			 &( internal_cache->entries_array ),
-			 NULL,
-			 NULL );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create flat table.",
+			 function );
+
+			goto on_error;
 		}
-		memory_free(
-		 internal_cache );
 	}
-	return( -1 );
-}
+	else if( maximum_cache_entries <= LIBFCACHE_LINEAR_TABLE_MAXIMUM_NUMBER_OF_SLOTS )
+	{
+		/* Small caches use a linear table since their identifiers fit in a few cache lines
+		 */
+		if( libfcache_linear_table_initialize(
+		     &( internal_cache->linear_table ),
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create linear table.",
+			 function );
 
-/* Frees a cache
- * Returns 1 if successful or -1 on error
- */
-int libfcache_cache_free(
-     libfcache_cache_t **cache,
-     libcerror_error_t **error )
-{
-	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_free";
-	int result                                 = 1;
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfcache_hash_table_initialize(
+		     &( internal_cache->hash_table ),
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash table.",
+			 function );
 
-	if( cache == NULL )
+			goto on_error;
+		}
+	}
+	if( libfcache_file_slots_initialize(
+	     &( internal_cache->file_slots ),
+	     maximum_cache_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid cache.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file slots.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *cache != NULL )
+	if( ( flags & LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT ) != 0 )
 	{
-		internal_cache = (libfcache_internal_cache_t *) *cache;
-		*cache         = NULL;
-
-		if( libcdata_list_free(
-		     &( internal_cache->entries_list ),
-		     NULL,
+		if( libfcache_policy_initialize_clock(
+		     &( internal_cache->policy ),
+		     maximum_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the entries list.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create clock policy.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		if( libcdata_array_free(
-		     &( internal_cache->entries_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+	}
+	if( ( flags & LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT ) != 0 )
+	{
+		if( libfcache_policy_initialize_two_queue(
+		     &( internal_cache->policy ),
+		     maximum_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the entries array.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create 2Q policy.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		memory_free(
-		 internal_cache );
 	}
-	return( result );
-}
+	if( ( flags & LIBFCACHE_CACHE_FLAG_S3_FIFO_REPLACEMENT ) != 0 )
+	{
+		if( libfcache_policy_initialize_s3_fifo(
+		     &( internal_cache->policy ),
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create S3-FIFO policy.",
+			 function );
 
-/* Empties the cache
- * Returns 1 if successful or -1 on error
- */
-int libfcache_cache_empty(
-     libfcache_cache_t *cache,
-     libcerror_error_t **error )
-{
-	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_empty";
+			goto on_error;
+		}
+	}
+	if( ( flags & LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT ) != 0 )
+	{
+		if( libfcache_policy_initialize_greedy_dual(
+		     &( internal_cache->policy ),
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create GreedyDual-Size-Frequency policy.",
+			 function );
 
-	if( cache == NULL )
+			goto on_error;
+		}
+	}
+	if( ( flags & LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid cache.",
-		 function );
+		if( libfcache_frequency_sketch_initialize(
+		     &( internal_cache->frequency_sketch ),
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create frequency sketch.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-	internal_cache = (libfcache_internal_cache_t *) cache;
+	internal_cache->admission_window_index = -1;
+	internal_cache->flags = flags;
 
-	if( libcdata_list_empty(
-	     internal_cache->entries_list,
-	     NULL,
+	if( ( flags & LIBFCACHE_CACHE_FLAG_PREALLOCATE_VALUES ) != 0 )
+	{
+		if( (size_t) maximum_cache_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfcache_internal_cache_value_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum cache entries value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		internal_cache->preallocated_values = (libfcache_internal_cache_value_t *) memory_allocate(
+		                                                                           sizeof( libfcache_internal_cache_value_t ) * maximum_cache_entries );
+
+		if( internal_cache->preallocated_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create preallocated cache values.",
+			 function );
+
+			goto on_error;
+		}
+		internal_cache->number_of_preallocated_values = maximum_cache_entries;
+
+		if( libfcache_internal_cache_preallocate_values(
+		     internal_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to preallocate cache values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfcache_internal_cache_add_unused_free_slots(
+	     internal_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty entries list.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add unused cache entries to free slots.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_clear(
-	     internal_cache->entries_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libfcache_hit_buffers_initialize(
+	     &( internal_cache->hit_buffers ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear entries array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hit buffers.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_cache->number_of_cache_values = 0;
-
-	return( 1 );
-}
-
-/* Clones (duplicates) the cache, not the cache values
- * Returns 1 if successful or -1 on error
- */
-int libfcache_cache_clone(
-     libfcache_cache_t **destination_cache,
-     libfcache_cache_t *source_cache,
-     libcerror_error_t **error )
-{
-	libfcache_internal_cache_t *internal_source_cache = NULL;
-	static char *function                             = "libfcache_cache_clone";
-	int number_of_cache_entries                       = 0;
-
-	if( destination_cache == NULL )
+	if( libfcache_pending_loads_initialize(
+	     &( internal_cache->pending_loads ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid destination cache.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pending loads.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *destination_cache != NULL )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_cache->read_write_lock ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: destination cache already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( source_cache == NULL )
-	{
-		*destination_cache = NULL;
+#endif
+	*cache = (libfcache_cache_t *) internal_cache;
 
-		return( 1 );
-	}
-	internal_source_cache = (libfcache_internal_cache_t *) source_cache;
+	return( 1 );
 
+on_error:
+	if( internal_cache != NULL )
+	{
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		if( internal_cache->pending_loads != NULL )
+		{
+			libfcache_pending_loads_free(
+			 &( internal_cache->pending_loads ),
+			 NULL );
+		}
+		if( internal_cache->hit_buffers != NULL )
+		{
+			libfcache_hit_buffers_free(
+			 &( internal_cache->hit_buffers ),
+			 NULL );
+		}
+#endif
+		if( internal_cache->policy != NULL )
+		{
+			libfcache_policy_free(
+			 &( internal_cache->policy ),
+			 NULL );
+		}
+		if( internal_cache->hash_table != NULL )
+		{
+			libfcache_hash_table_free(
+			 &( internal_cache->hash_table ),
+			 NULL );
+		}
+		if( internal_cache->linear_table != NULL )
+		{
+			libfcache_linear_table_free(
+			 &( internal_cache->linear_table ),
+			 NULL );
+		}
+		if( internal_cache->flat_table != NULL )
+		{
+			libfcache_flat_table_free(
+			 &( internal_cache->flat_table ),
+			 NULL );
+		}
+		if( internal_cache->file_slots != NULL )
+		{
+			libfcache_file_slots_free(
+			 &( internal_cache->file_slots ),
+			 NULL );
+		}
+		if( internal_cache->free_slots != NULL )
+		{
+			libfcache_slot_queues_free(
+			 &( internal_cache->free_slots ),
+			 NULL );
+		}
+		if( internal_cache->used_slots != NULL )
+		{
+			libfcache_slot_queues_free(
+			 &( internal_cache->used_slots ),
+			 NULL );
+		}
+		if( internal_cache->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_cache->entries_array ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+			 NULL );
+		}
+		if( internal_cache->preallocated_values != NULL )
+		{
+			memory_free(
+			 internal_cache->preallocated_values );
+		}
+		memory_free(
+		 internal_cache );
+	}
+	return( -1 );
+}
+
+/* Creates a cache with a replacement policy
+ * Make sure the value cache is referencing, is set to NULL
+ * The flags can only contain LIBFCACHE_CACHE_FLAG_FLAT_INDEX and LIBFCACHE_CACHE_FLAG_PREALLOCATE_VALUES
+ * The policy data is resized to the maximum cache entries and the cache
+ * takes over management of the policy data if free_policy_data is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_initialize_with_policy(
+     libfcache_cache_t **cache,
+     int maximum_cache_entries,
+     uint8_t flags,
+     intptr_t *policy_data,
+     int (*free_policy_data)(
+            intptr_t **policy_data,
+            libcerror_error_t **error ),
+     int (*clone_policy_data)(
+            intptr_t **destination_policy_data,
+            intptr_t *source_policy_data,
+            libcerror_error_t **error ),
+     int (*clear_policy_data)(
+            intptr_t *policy_data,
+            libcerror_error_t **error ),
+     int (*resize_policy_data)(
+            intptr_t *policy_data,
+            int number_of_slots,
+            libcerror_error_t **error ),
+     int (*insert_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*reference_slot)(
+            intptr_t *policy_data,
+            int slot,
+            libcerror_error_t **error ),
+     int (*remove_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*get_victim_slot)(
+            intptr_t *policy_data,
+            int *slot,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *safe_cache              = NULL;
+	libfcache_internal_cache_t *internal_cache = NULL;
+	libfcache_policy_t *policy                 = NULL;
+	static char *function                      = "libfcache_cache_initialize_with_policy";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBFCACHE_CACHE_FLAG_FLAT_INDEX | LIBFCACHE_CACHE_FLAG_PREALLOCATE_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( libfcache_policy_initialize(
+	     &policy,
+	     policy_data,
+	     free_policy_data,
+	     clone_policy_data,
+	     clear_policy_data,
+	     resize_policy_data,
+	     insert_slot,
+	     reference_slot,
+	     remove_slot,
+	     get_victim_slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create policy.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_policy_resize(
+	     policy,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize policy.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize_with_flags(
+	     &safe_cache,
+	     maximum_cache_entries,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cache = (libfcache_internal_cache_t *) safe_cache;
+
+	internal_cache->policy = policy;
+
+	*cache = safe_cache;
+
+	return( 1 );
+
+on_error:
+	if( policy != NULL )
+	{
+		/* The policy data remains managed by the caller on error
+		 */
+		policy->policy_data = NULL;
+
+		libfcache_policy_free(
+		 &policy,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_free(
+     libfcache_cache_t **cache,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_free";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		internal_cache = (libfcache_internal_cache_t *) *cache;
+		*cache         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_cache->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the entries array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_cache->hash_table != NULL )
+		{
+			if( libfcache_hash_table_free(
+			     &( internal_cache->hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cache->policy != NULL )
+		{
+			if( libfcache_policy_free(
+			     &( internal_cache->policy ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the policy.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cache->frequency_sketch != NULL )
+		{
+			if( libfcache_frequency_sketch_free(
+			     &( internal_cache->frequency_sketch ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the frequency sketch.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cache->linear_table != NULL )
+		{
+			if( libfcache_linear_table_free(
+			     &( internal_cache->linear_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the linear table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cache->flat_table != NULL )
+		{
+			if( libfcache_flat_table_free(
+			     &( internal_cache->flat_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the flat table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libfcache_file_slots_free(
+		     &( internal_cache->file_slots ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the file slots.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_slot_queues_free(
+		     &( internal_cache->free_slots ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the free slots.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_slot_queues_free(
+		     &( internal_cache->used_slots ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the used slots.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_cache->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_hit_buffers_free(
+		     &( internal_cache->hit_buffers ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hit buffers.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_pending_loads_free(
+		     &( internal_cache->pending_loads ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pending loads.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_cache->preallocated_values != NULL )
+		{
+			memory_free(
+			 internal_cache->preallocated_values );
+		}
+		memory_free(
+		 internal_cache );
+	}
+	return( result );
+}
+
+/* Empties the cache
+ * A cache that contains pinned cache values cannot be emptied
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_empty(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_empty";
+	int result            = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* A pinned cache value is not freed until it is released
+	 */
+	result = libfcache_internal_cache_has_pinned_values(
+	          internal_cache,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if cache contains pinned values.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to empty cache that contains pinned values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_clear(
+	     internal_cache->entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear entries array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_internal_cache_index_clear(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_clear(
+	     internal_cache->free_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear free slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_clear(
+	     internal_cache->used_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear used slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->policy != NULL )
+	{
+		if( libfcache_policy_clear(
+		     internal_cache->policy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear policy.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_cache->frequency_sketch != NULL )
+	{
+		if( libfcache_frequency_sketch_clear(
+		     internal_cache->frequency_sketch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear frequency sketch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( internal_cache->hit_buffers != NULL )
+	{
+		if( libfcache_hit_buffers_clear(
+		     internal_cache->hit_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear hit buffers.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	internal_cache->admission_window_index = -1;
+	internal_cache->cache_size             = 0;
+	internal_cache->next_expiry_timestamp  = 0;
+
+	if( internal_cache->preallocated_values != NULL )
+	{
+		if( libfcache_internal_cache_preallocate_values(
+		     internal_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to preallocate cache values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfcache_internal_cache_add_unused_free_slots(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add unused cache entries to free slots.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Empties the cache
+ * A cache that contains pinned cache values cannot be emptied
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_empty(
+     libfcache_cache_t *cache,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_empty";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_empty(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty cache.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Clones (duplicates) the cache, not the cache values
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_clone(
+     libfcache_cache_t **destination_cache,
+     libfcache_cache_t *source_cache,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_destination_cache = NULL;
+	libfcache_internal_cache_t *internal_source_cache      = NULL;
+	static char *function                                  = "libfcache_cache_clone";
+	int number_of_cache_entries                            = 0;
+
+	if( destination_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_cache == NULL )
+	{
+		*destination_cache = NULL;
+
+		return( 1 );
+	}
+	internal_source_cache = (libfcache_internal_cache_t *) source_cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_source_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_source_cache->entries_array,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries from source entries array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize_with_flags(
+	     destination_cache,
+	     number_of_cache_entries,
+	     internal_source_cache->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination cache.",
+		 function );
+
+		goto on_error;
+	}
+	internal_destination_cache = (libfcache_internal_cache_t *) *destination_cache;
+
+	internal_destination_cache->maximum_cache_size = internal_source_cache->maximum_cache_size;
+	internal_destination_cache->time_to_live       = internal_source_cache->time_to_live;
+
+	/* A replacement policy that was not created from the flags is cloned
+	 */
+	if( ( internal_destination_cache->policy == NULL )
+	 && ( internal_source_cache->policy != NULL ) )
+	{
+		if( libfcache_policy_clone(
+		     &( internal_destination_cache->policy ),
+		     internal_source_cache->policy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to clone policy.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_source_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfcache_cache_free(
+		 destination_cache,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_source_cache->read_write_lock,
+	 NULL );
+#endif
+	if( *destination_cache != NULL )
+	{
+		libfcache_cache_free(
+		 destination_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Resizes the cache
+ * A cache cannot be shrunk while the cache entries that are removed contain pinned cache values
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_resize(
+     libfcache_internal_cache_t *internal_cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_internal_cache_resize";
+	size64_t removed_cache_size                            = 0;
+	int cache_entry_index                                  = 0;
+	int number_of_cache_entries                            = 0;
+	int result                                             = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_cache->entries_array,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries from entries array.",
+		 function );
+
+		return( -1 );
+	}
+	/* A pinned cache value is not freed by a resize until it is released
+	 */
+	result = libfcache_internal_cache_has_pinned_values(
+	          internal_cache,
+	          maximum_cache_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if cache contains pinned values.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to resize cache that contains pinned values in the removed cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the size of the cache values that are freed by the resize
+	 */
+	for( cache_entry_index = maximum_cache_entries;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache->entries_array,
+		     cache_entry_index,
+		     (intptr_t **) &internal_cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d from entries array.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( internal_cache_value != NULL )
+		{
+			removed_cache_size += internal_cache_value->value_size;
+		}
+	}
+	if( libfcache_internal_cache_index_resize(
+	     internal_cache,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_resize(
+	     internal_cache->free_slots,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize free slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_resize(
+	     internal_cache->used_slots,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize used slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->policy != NULL )
+	{
+		if( libfcache_policy_resize(
+		     internal_cache->policy,
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize policy.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_cache->frequency_sketch != NULL )
+	{
+		if( libfcache_frequency_sketch_resize(
+		     internal_cache->frequency_sketch,
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize frequency sketch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_cache->admission_window_index >= maximum_cache_entries )
+	{
+		internal_cache->admission_window_index = -1;
+	}
+	if( libcdata_array_resize(
+	     internal_cache->entries_array,
+	     maximum_cache_entries,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize entries array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The cache size is only reduced after the last resize that can fail
+	 */
+	internal_cache->cache_size -= removed_cache_size;
+
+	/* The cache values of the cache entries that were added are created
+	 * when the cache is resized instead of when a value is set
+	 */
+	if( internal_cache->preallocated_values != NULL )
+	{
+		if( libfcache_internal_cache_preallocate_values(
+		     internal_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to preallocate cache values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfcache_internal_cache_add_unused_free_slots(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add unused cache entries to free slots.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes the cache
+ * A cache cannot be shrunk while the cache entries that are removed contain pinned cache values
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_resize(
+     libfcache_cache_t *cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_resize";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_resize(
+	     internal_cache,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize cache.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the generation of the cache
+ * The generation can be retrieved without holding the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_get_generation(
+     libfcache_internal_cache_t *internal_cache,
+     uint32_t *generation,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_get_generation";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+	*generation = __atomic_load_n(
+	               &( internal_cache->generation ),
+	               __ATOMIC_ACQUIRE );
+
+#elif defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	*generation = (uint32_t) InterlockedCompareExchange(
+	                          (LONG volatile *) &( internal_cache->generation ),
+	                          0,
+	                          0 );
+
+#elif defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	*generation = internal_cache->generation;
+
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	*generation = internal_cache->generation;
+
+#endif
+	return( 1 );
+}
+
+/* Increments the generation of the cache
+ * The generation is incremented every time the index is modified
+ * or a value is stored, evicted or its expiry changed, so that a front
+ * cache can detect that a value it refers to is no longer valid,
+ * this requires the write lock to be held
+ */
+static void libfcache_internal_cache_increment_generation(
+             libfcache_internal_cache_t *internal_cache )
+{
+	if( internal_cache == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+	__atomic_add_fetch(
+	 &( internal_cache->generation ),
+	 1,
+	 __ATOMIC_RELEASE );
+
+#elif defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	InterlockedIncrement(
+	 (LONG volatile *) &( internal_cache->generation ) );
+
+#else
+	internal_cache->generation += 1;
+
+#endif
+}
+
+/* Clears the index that maps identifiers to cache entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_index_clear(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_index_clear";
+	int result            = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
+
+	if( internal_cache->flat_table != NULL )
+	{
+		result = libfcache_flat_table_clear(
+		          internal_cache->flat_table,
+		          error );
+	}
+	else if( internal_cache->linear_table != NULL )
+	{
+		result = libfcache_linear_table_clear(
+		          internal_cache->linear_table,
+		          error );
+	}
+	else
+	{
+		result = libfcache_hash_table_clear(
+		          internal_cache->hash_table,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_file_slots_clear(
+	     internal_cache->file_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear file slots.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes the index that maps identifiers to cache entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_index_resize(
+     libfcache_internal_cache_t *internal_cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_index_resize";
+	int result            = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
+
+	if( internal_cache->flat_table != NULL )
+	{
+		result = libfcache_flat_table_resize(
+		          internal_cache->flat_table,
+		          maximum_cache_entries,
+		          error );
+	}
+	else if( internal_cache->linear_table != NULL )
+	{
+		result = libfcache_linear_table_resize(
+		          internal_cache->linear_table,
+		          maximum_cache_entries,
+		          error );
+	}
+	else
+	{
+		result = libfcache_hash_table_resize(
+		          internal_cache->hash_table,
+		          maximum_cache_entries,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_file_slots_resize(
+	     internal_cache->file_slots,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize file slots.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache entry index that matches the identifier from the index
+ * Returns 1 if successful, 0 if no such cache entry or -1 on error
+ */
+int libfcache_internal_cache_index_get_slot_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *cache_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_index_get_slot_by_identifier";
+	int result            = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->flat_table != NULL )
+	{
+		result = libfcache_flat_table_get_slot_by_identifier(
+		          internal_cache->flat_table,
+		          file_index,
+		          offset,
+		          timestamp,
+		          cache_entry_index,
+		          error );
+	}
+	else if( internal_cache->linear_table != NULL )
+	{
+		result = libfcache_linear_table_get_slot_by_identifier(
+		          internal_cache->linear_table,
+		          file_index,
+		          offset,
+		          timestamp,
+		          cache_entry_index,
+		          error );
+	}
+	else
+	{
+		result = libfcache_hash_table_get_slot_by_identifier(
+		          internal_cache->hash_table,
+		          file_index,
+		          offset,
+		          timestamp,
+		          cache_entry_index,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Inserts a cache entry index with a specific identifier into the index
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_index_insert_slot(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_index_insert_slot";
+	int result            = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
+
+	if( internal_cache->flat_table != NULL )
+	{
+		result = libfcache_flat_table_insert_slot(
+		          internal_cache->flat_table,
+		          cache_entry_index,
+		          file_index,
+		          offset,
+		          timestamp,
+		          error );
+	}
+	else if( internal_cache->linear_table != NULL )
+	{
+		result = libfcache_linear_table_insert_slot(
+		          internal_cache->linear_table,
+		          cache_entry_index,
+		          file_index,
+		          offset,
+		          timestamp,
+		          error );
+	}
+	else
+	{
+		result = libfcache_hash_table_insert_slot(
+		          internal_cache->hash_table,
+		          cache_entry_index,
+		          file_index,
+		          offset,
+		          timestamp,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert slot: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_file_slots_insert_slot(
+	     internal_cache->file_slots,
+	     cache_entry_index,
+	     file_index,
+	     offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert slot: %d in file slots.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a cache entry index from the index
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_index_remove_slot(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_index_remove_slot";
+	int result            = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
+
+	if( internal_cache->flat_table != NULL )
+	{
+		result = libfcache_flat_table_remove_slot(
+		          internal_cache->flat_table,
+		          cache_entry_index,
+		          error );
+	}
+	else if( internal_cache->linear_table != NULL )
+	{
+		result = libfcache_linear_table_remove_slot(
+		          internal_cache->linear_table,
+		          cache_entry_index,
+		          error );
+	}
+	else
+	{
+		result = libfcache_hash_table_remove_slot(
+		          internal_cache->hash_table,
+		          cache_entry_index,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove slot: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_file_slots_remove_slot(
+	     internal_cache->file_slots,
+	     cache_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove slot: %d from file slots.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries of the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_number_of_entries(
+     libfcache_cache_t *cache,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_number_of_entries";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_cache->entries_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from entries array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of cache values
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_number_of_cache_values(
+     libfcache_cache_t *cache,
+     int *number_of_cache_values,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_number_of_cache_values";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_slot_queues_get_queue_size(
+	     internal_cache->used_slots,
+	     LIBFCACHE_CACHE_QUEUE_USED,
+	     number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of used slots.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_maximum_cache_size(
+     libfcache_cache_t *cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_maximum_cache_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_cache_size = internal_cache->maximum_cache_size;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum cache size
+ * The maximum cache size is the number of bytes the sizes of the cache values can add up to,
+ * where 0 represents no maximum. Cache values are cleared until the cache size fits
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_maximum_cache_size(
+     libfcache_cache_t *cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_set_maximum_cache_size";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache->maximum_cache_size = maximum_cache_size;
+
+	if( ( internal_cache->maximum_cache_size != 0 )
+	 && ( internal_cache->cache_size > internal_cache->maximum_cache_size ) )
+	{
+		if( libfcache_internal_cache_evict_values(
+		     internal_cache,
+		     -1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict cache values.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the cache size
+ * The cache size is the total size of the cache values in bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_cache_size(
+     libfcache_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_cache_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*cache_size = internal_cache->cache_size;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the time-to-live
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_time_to_live(
+     libfcache_cache_t *cache,
+     int64_t *time_to_live,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_time_to_live";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( time_to_live == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time-to-live.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*time_to_live = internal_cache->time_to_live;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the time-to-live
+ * The time-to-live is applied to the cache values that are set afterwards,
+ * where 0 represents values that do not expire. The time-to-live is relative
+ * to the timestamp of libfcache_date_time_get_timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_time_to_live(
+     libfcache_cache_t *cache,
+     int64_t time_to_live,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_set_time_to_live";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( time_to_live < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid time-to-live value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache->time_to_live = time_to_live;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Clears the cache value for the specific index
+ * A pinned cache value cannot be cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_clear_value_by_index(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_clear_value_by_index";
+	size_t value_size                    = 0;
+	off64_t offset                       = 0;
+	int64_t timestamp                    = 0;
+	uint8_t queue_number                 = 0;
+	int file_index                       = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( ( cache_value != NULL )
+	 && ( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to clear pinned cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_get_queue_number(
+	     internal_cache->free_slots,
+	     cache_entry_index,
+	     &queue_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve queue number of free slot: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_internal_cache_index_remove_slot(
+	     internal_cache,
+	     cache_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove cache value: %d from index.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( ( internal_cache->policy != NULL )
+	 && ( queue_number != LIBFCACHE_CACHE_QUEUE_FREE ) )
+	{
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &file_index,
+		     &offset,
+		     &timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libfcache_policy_remove_slot(
+		     internal_cache->policy,
+		     cache_entry_index,
+		     file_index,
+		     offset,
+		     timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove cache value: %d from policy.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( cache_value != NULL )
+	{
+		value_size = ( (libfcache_internal_cache_value_t *) cache_value )->value_size;
+	}
+	if( libfcache_cache_value_clear(
+	     cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear cache value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The cache value remains stored in the cache hence restore its cache index
+	 */
+	( (libfcache_internal_cache_value_t *) cache_value )->cache_index = cache_entry_index;
+
+	internal_cache->cache_size -= value_size;
+
+	/* The cache entry is reused before a value is replaced
+	 */
+	if( queue_number != LIBFCACHE_CACHE_QUEUE_FREE )
+	{
+		if( libfcache_slot_queues_prepend_slot(
+		     internal_cache->free_slots,
+		     LIBFCACHE_CACHE_QUEUE_FREE,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend free slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Clears the cache value for the specific index
+ * A pinned cache value cannot be cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_clear_value_by_index(
+     libfcache_cache_t *cache,
+     int cache_entry_index,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_clear_value_by_index";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_clear_value_by_index(
+	     internal_cache,
+	     cache_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Invalidates the cache values of a specific file index
+ * The values are freed, if managed, and their cache entries are reused
+ * before other values are replaced, a pinned cache value is not invalidated
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_invalidate_file(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_invalidate_file";
+	int cache_entry_index                = 0;
+	int next_cache_entry_index           = 0;
+	int result                           = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_file_slots_get_first_slot(
+	          internal_cache->file_slots,
+	          file_index,
+	          &cache_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first slot of file index: %d.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	while( result == 1 )
+	{
+		/* The next slot is retrieved before the cache value is evicted
+		 * since evicting removes the slot from the file slots
+		 */
+		result = libfcache_file_slots_get_next_slot(
+		          internal_cache->file_slots,
+		          cache_entry_index,
+		          &next_cache_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next slot of slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache->entries_array,
+		     cache_entry_index,
+		     (intptr_t **) &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d from entries array.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count == 0 )
+		{
+			if( libfcache_internal_cache_evict_value(
+			     internal_cache,
+			     cache_entry_index,
+			     cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to evict cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		cache_entry_index = next_cache_entry_index;
+	}
+	return( 1 );
+}
+
+/* Invalidates the cache values of a specific file index
+ * This takes time proportional to the number of cache values of the file index
+ * The values are freed, if managed, and their cache entries are reused
+ * before other values are replaced, a pinned cache value is not invalidated
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_invalidate_file(
+     libfcache_cache_t *cache,
+     int file_index,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_invalidate_file";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_invalidate_file(
+	     internal_cache,
+	     file_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to invalidate cache values of file index: %d.",
+		 function,
+		 file_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Invalidates the cache values of a specific file index within an offset range
+ * The range contains the cache values with an offset equal to or larger than
+ * the range offset and smaller than the range offset + range size
+ * The values are freed, if managed, and their cache entries are reused
+ * before other values are replaced, a pinned cache value is not invalidated
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_invalidate_range(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_invalidate_range";
+	off64_t range_end_offset             = 0;
+	off64_t value_offset                 = 0;
+	int64_t value_timestamp              = 0;
+	int cache_entry_index                = 0;
+	int next_cache_entry_index           = 0;
+	int result                           = 0;
+	int value_file_index                 = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size > (size64_t) ( INT64_MAX - range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid range size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	range_end_offset = range_offset + (off64_t) range_size;
+
+	result = libfcache_file_slots_get_first_slot_from_offset(
+	          internal_cache->file_slots,
+	          file_index,
+	          range_offset,
+	          &cache_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first slot of file index: %d from offset: %" PRIi64 ".",
+		 function,
+		 file_index,
+		 range_offset );
+
+		return( -1 );
+	}
+	while( result == 1 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache->entries_array,
+		     cache_entry_index,
+		     (intptr_t **) &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d from entries array.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &value_file_index,
+		     &value_offset,
+		     &value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( value_offset >= range_end_offset )
+		{
+			break;
+		}
+		/* The next slot is retrieved before the cache value is evicted
+		 * since evicting removes the slot from the file slots
+		 */
+		result = libfcache_file_slots_get_next_slot(
+		          internal_cache->file_slots,
+		          cache_entry_index,
+		          &next_cache_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next slot of slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count == 0 )
+		{
+			if( libfcache_internal_cache_evict_value(
+			     internal_cache,
+			     cache_entry_index,
+			     cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to evict cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		cache_entry_index = next_cache_entry_index;
+	}
+	return( 1 );
+}
+
+/* Invalidates the cache values of a specific file index within an offset range
+ * This takes time proportional to the logarithm of the number of cache values
+ * of the file index and the number of cache values in the range
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_invalidate_range(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_invalidate_range";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size > (size64_t) ( INT64_MAX - range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid range size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_invalidate_range(
+	     internal_cache,
+	     file_index,
+	     range_offset,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to invalidate cache values of file index: %d in range: %" PRIi64 " - %" PRIi64 ".",
+		 function,
+		 file_index,
+		 range_offset,
+		 range_offset + (off64_t) range_size );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Calls a callback function for the cache values of a specific file index within an offset range
+ * The cache values are passed in order of their offset, expired cache values are skipped
+ * The callback function returns 1 to continue, 0 to stop the iteration or -1 on error
+ * Returns 1 if successful, 0 if the iteration was stopped or -1 on error
+ */
+int libfcache_internal_cache_iterate_values_in_range(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*callback_function)(
+            libfcache_cache_value_t *cache_value,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_iterate_values_in_range";
+	off64_t range_end_offset             = 0;
+	off64_t value_offset                 = 0;
+	int64_t current_timestamp            = 0;
+	int64_t expiry_timestamp             = 0;
+	int64_t value_timestamp              = 0;
+	int cache_entry_index                = 0;
+	int callback_result                  = 0;
+	int result                           = 0;
+	int value_file_index                 = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size > (size64_t) ( INT64_MAX - range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid range size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	range_end_offset = range_offset + (off64_t) range_size;
+
+	/* The current timestamp is retrieved once for the iteration and only if
+	 * the cache contains values that can expire
+	 */
+	if( internal_cache->next_expiry_timestamp != 0 )
+	{
+		if( libfcache_date_time_get_timestamp(
+		     &current_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current timestamp.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libfcache_file_slots_get_first_slot_from_offset(
+	          internal_cache->file_slots,
+	          file_index,
+	          range_offset,
+	          &cache_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first slot of file index: %d from offset: %" PRIi64 ".",
+		 function,
+		 file_index,
+		 range_offset );
+
+		return( -1 );
+	}
+	while( result == 1 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache->entries_array,
+		     cache_entry_index,
+		     (intptr_t **) &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d from entries array.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &value_file_index,
+		     &value_offset,
+		     &value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( value_offset >= range_end_offset )
+		{
+			break;
+		}
+		if( current_timestamp != 0 )
+		{
+			if( libfcache_cache_value_get_expiry_timestamp(
+			     cache_value,
+			     &expiry_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve expiry timestamp from cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		/* A pinned cache value does not expire until it is released
+		 */
+		if( ( current_timestamp == 0 )
+		 || ( expiry_timestamp == 0 )
+		 || ( current_timestamp < expiry_timestamp )
+		 || ( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count != 0 ) )
+		{
+			callback_result = callback_function(
+			                   cache_value,
+			                   callback_data,
+			                   error );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: callback function failed for cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			else if( callback_result == 0 )
+			{
+				return( 0 );
+			}
+		}
+		result = libfcache_file_slots_get_next_slot(
+		          internal_cache->file_slots,
+		          cache_entry_index,
+		          &cache_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next slot of slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calls a callback function for the cache values of a specific file index within an offset range
+ * The cache values are passed in order of their offset, expired cache values are skipped
+ * The callback function returns 1 to continue, 0 to stop the iteration or -1 on error
+ * The callback function is called with the cache locked and must not call other cache functions
+ * Returns 1 if successful, 0 if the iteration was stopped or -1 on error
+ */
+int libfcache_cache_iterate_values_in_range(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*callback_function)(
+            libfcache_cache_value_t *cache_value,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_iterate_values_in_range";
+	int result                                 = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size > (size64_t) ( INT64_MAX - range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid range size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfcache_internal_cache_iterate_values_in_range(
+	          internal_cache,
+	          file_index,
+	          range_offset,
+	          range_size,
+	          callback_function,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to iterate cache values of file index: %d in range: %" PRIi64 " - %" PRIi64 ".",
+		 function,
+		 file_index,
+		 range_offset,
+		 range_offset + (off64_t) range_size );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+
+/* Applies the promotions of the used slots recorded in the hit buffers
+ * The promotions are applied per hit buffer, hence the order of hits on slots
+ * in different hit buffers is not maintained
+ * A hit on a slot that was cleared since it was recorded is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_apply_hit_buffers(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	int slots[ LIBFCACHE_HIT_BUFFERS_BUFFER_SIZE ];
+
+	static char *function       = "libfcache_internal_cache_apply_hit_buffers";
+	int buffer_index            = 0;
+	int cache_entry_index       = 0;
+	int number_of_cache_entries = 0;
+	int number_of_slots         = 0;
+	int slot_index              = 0;
+	uint8_t queue_number        = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->hit_buffers == NULL )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_cache->entries_array,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries from entries array.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libfcache_hit_buffers_remove_slots(
+		     internal_cache->hit_buffers,
+		     buffer_index,
+		     slots,
+		     &number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove slots from hit buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		for( slot_index = 0;
+		     slot_index < number_of_slots;
+		     slot_index++ )
+		{
+			cache_entry_index = slots[ slot_index ];
+
+			if( ( cache_entry_index >= number_of_cache_entries )
+			 || ( cache_entry_index == internal_cache->admission_window_index ) )
+			{
+				continue;
+			}
+			if( libfcache_slot_queues_get_queue_number(
+			     internal_cache->free_slots,
+			     cache_entry_index,
+			     &queue_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve queue number of free slot: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			if( queue_number == LIBFCACHE_CACHE_QUEUE_FREE )
+			{
+				continue;
+			}
+			if( libfcache_slot_queues_get_queue_number(
+			     internal_cache->used_slots,
+			     cache_entry_index,
+			     &queue_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve queue number of used slot: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			if( queue_number != LIBFCACHE_CACHE_QUEUE_USED )
+			{
+				continue;
+			}
+			if( libfcache_slot_queues_prepend_slot(
+			     internal_cache->used_slots,
+			     LIBFCACHE_CACHE_QUEUE_USED,
+			     cache_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to prepend used slot: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the cache value that matches the file index, offset and timestamp
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_internal_cache_get_value_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *safe_cache_value = NULL;
+	static char *function                     = "libfcache_internal_cache_get_value_by_identifier";
+	int cache_entry_index                     = 0;
+	int result                                = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_value = NULL;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libfcache_internal_cache_apply_hit_buffers(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to apply hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache->frequency_sketch != NULL )
+	{
+		if( libfcache_frequency_sketch_increment(
+		     internal_cache->frequency_sketch,
+		     file_index,
+		     offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment frequency of identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libfcache_internal_cache_index_get_slot_by_identifier(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &cache_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry index by identifier from index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) &safe_cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( safe_cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	/* An expired value is cleared and handled as a miss
+	 */
+	if( ( (libfcache_internal_cache_value_t *) safe_cache_value )->expiry_timestamp != 0 )
+	{
+		result = libfcache_internal_cache_expire_value(
+		          internal_cache,
+		          cache_entry_index,
+		          safe_cache_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to expire cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 0 );
+		}
+	}
+	/* With a replacement policy the policy determines the effect of a hit
+	 */
+	if( internal_cache->policy != NULL )
+	{
+		if( libfcache_policy_reference_slot(
+		     internal_cache->policy,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reference cache value: %d in policy.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		*cache_value = safe_cache_value;
+
+		return( 1 );
+	}
+	/* The value in the admission window is not moved so that it is replaced
+	 * by the next value that is not admitted
+	 */
+	if( cache_entry_index == internal_cache->admission_window_index )
+	{
+		*cache_value = safe_cache_value;
+
+		return( 1 );
+	}
+	/* Move the slot to the front of the used slots, unless it is already there
+	 */
+	if( libfcache_slot_queues_prepend_slot(
+	     internal_cache->used_slots,
+	     LIBFCACHE_CACHE_QUEUE_USED,
+	     cache_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to prepend used slot: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	*cache_value = safe_cache_value;
+
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+
+/* Retrieves the cache value that matches the file index, offset and timestamp
+ * without modifying the cache, so that it can be called with the read lock held
+ * requires_write is set if the lookup needs to modify the cache, such as
+ * to clear an expired value, in which case the lookup must be repeated with the write lock held
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_internal_cache_get_value_by_identifier_for_read(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     uint8_t *requires_write,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *safe_cache_value = NULL;
+	static char *function                     = "libfcache_internal_cache_get_value_by_identifier_for_read";
+	int cache_entry_index                     = 0;
+	int result                                = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->hit_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache - missing hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( requires_write == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid requires write.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_value    = NULL;
+	*requires_write = 1;
+
+	/* Both a hit and a miss update the frequency sketch
+	 */
+	if( internal_cache->frequency_sketch != NULL )
+	{
+		return( 0 );
+	}
+	result = libfcache_internal_cache_index_get_slot_by_identifier(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &cache_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry index by identifier from index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*requires_write = 0;
+
+		return( 0 );
+	}
+	/* With a replacement policy every hit is referenced in the policy
+	 */
+	if( internal_cache->policy != NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) &safe_cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( safe_cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	/* A value that can expire needs to be checked and possibly cleared
+	 */
+	if( ( (libfcache_internal_cache_value_t *) safe_cache_value )->expiry_timestamp != 0 )
+	{
+		return( 0 );
+	}
+	/* The promotion is recorded in the hit buffers and applied the next time
+	 * the write lock is held, if the hit buffer is full the promotion is dropped
+	 */
+	if( cache_entry_index != internal_cache->admission_window_index )
+	{
+		if( libfcache_hit_buffers_append_slot(
+		     internal_cache->hit_buffers,
+		     cache_entry_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append slot: %d to hit buffers.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	*cache_value    = safe_cache_value;
+	*requires_write = 0;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the cache value that matches the file index, offset and timestamp
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_cache_get_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_value_by_identifier";
+	int result                                 = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	uint8_t requires_write                     = 0;
+#endif
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* Most lookups do not modify the cache and are handled with the read lock held
+	 * so that concurrent readers do not block each other
+	 */
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          &requires_write,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value by identifier.",
+		 function );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == -1 )
+	 || ( requires_write == 0 ) )
+	{
+		return( result );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfcache_internal_cache_get_value_by_identifier(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value by identifier.",
+		 function );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the cache values that match the file indexes, offsets and timestamps
+ * The lookups are resolved in a single pass with the read/write lock grabbed
+ * once for reading and, if a lookup needs to modify the cache, once for writing
+ * cache_values contains the cache value of every identifier that is in the cache
+ * and NULL for every identifier that is not
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_values_by_identifiers(
+     libfcache_cache_t *cache,
+     int number_of_identifiers,
+     const int *file_indexes,
+     const off64_t *offsets,
+     const int64_t *timestamps,
+     libfcache_cache_value_t **cache_values,
+     int *number_of_hits,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_values_by_identifiers";
+	int identifier_index                       = 0;
+	int result                                 = 0;
+	int safe_number_of_hits                    = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	uint8_t requires_write                     = 0;
+#endif
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( number_of_identifiers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of identifiers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamps.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits = 0;
+
+	if( number_of_identifiers == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	/* The lookups are handled with the read lock held until a lookup
+	 * needs to modify the cache, the remaining lookups are handled
+	 * with the write lock held
+	 */
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		result = libfcache_internal_cache_get_value_by_identifier_for_read(
+		          internal_cache,
+		          file_indexes[ identifier_index ],
+		          offsets[ identifier_index ],
+		          timestamps[ identifier_index ],
+		          &( cache_values[ identifier_index ] ),
+		          &requires_write,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d by identifier.",
+			 function,
+			 identifier_index );
+
+			break;
+		}
+		else if( requires_write != 0 )
+		{
+			break;
+		}
+		else if( result != 0 )
+		{
+			safe_number_of_hits++;
+		}
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	if( identifier_index >= number_of_identifiers )
+	{
+		*number_of_hits = safe_number_of_hits;
+
+		return( 1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The current timestamp is retrieved once for the batch and only if
+	 * the cache contains values that can expire
+	 */
+	result = 1;
+
+	if( internal_cache->next_expiry_timestamp != 0 )
+	{
+		if( libfcache_date_time_get_timestamp(
+		     &( internal_cache->batch_timestamp ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current timestamp.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The lookups continue from the first lookup that required the write lock
+	 */
+	while( ( result != -1 )
+	    && ( identifier_index < number_of_identifiers ) )
+	{
+		result = libfcache_internal_cache_get_value_by_identifier(
+		          internal_cache,
+		          file_indexes[ identifier_index ],
+		          offsets[ identifier_index ],
+		          timestamps[ identifier_index ],
+		          &( cache_values[ identifier_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d by identifier.",
+			 function,
+			 identifier_index );
+		}
+		else if( result != 0 )
+		{
+			safe_number_of_hits++;
+		}
+		identifier_index++;
+	}
+	internal_cache->batch_timestamp = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	*number_of_hits = safe_number_of_hits;
+
+	return( 1 );
+}
+
+/* Retrieves the cache value that matches the file index, offset and timestamp
+ * together with its expiry timestamp and the generation of the cache at the time
+ * of the lookup, this is used to fill a front cache
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_cache_get_value_with_generation_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     int64_t *expiry_timestamp,
+     uint32_t *generation,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_value_with_generation_by_identifier";
+	int result                                 = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	uint8_t requires_write                     = 0;
+#endif
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( expiry_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expiry timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          &requires_write,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value by identifier.",
+		 function );
+	}
+	else if( requires_write == 0 )
+	{
+		*generation       = internal_cache->generation;
+		*expiry_timestamp = 0;
+
+		if( result != 0 )
+		{
+			*expiry_timestamp = ( (libfcache_internal_cache_value_t *) *cache_value )->expiry_timestamp;
+		}
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == -1 )
+	 || ( requires_write == 0 ) )
+	{
+		return( result );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfcache_internal_cache_get_value_by_identifier(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value by identifier.",
+		 function );
+	}
+	else
+	{
+		/* The generation is retrieved after the lookup since a lookup
+		 * can clear an expired value
+		 */
+		*generation       = internal_cache->generation;
+		*expiry_timestamp = 0;
+
+		if( result != 0 )
+		{
+			*expiry_timestamp = ( (libfcache_internal_cache_value_t *) *cache_value )->expiry_timestamp;
+		}
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the cache value that matches the file index, offset and timestamp
+ * or loads the value and sets it in the cache if there is no such value
+ * The load_value function is called without the read/write lock held
+ * With multi-thread support concurrent calls for the same identifier are
+ * coalesced, only one thread calls load_value and the others wait for it
+ * The load_value function therefore should not retrieve the same identifier
+ * A loaded value is set with its size and a cost of 1
+ * If another value with the same identifier was set while the value was loaded,
+ * that cache value is returned and the loaded value is freed if managed
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_or_load_value(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int (*load_value)(
+            intptr_t *load_data,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            intptr_t **value,
+            size_t *value_size,
+            libcerror_error_t **error ),
+     intptr_t *load_data,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	intptr_t *value                            = NULL;
+	static char *function                      = "libfcache_cache_get_or_load_value";
+	size_t value_size                          = 0;
+	int64_t expiry_timestamp                   = 0;
+	uint32_t generation                        = 0;
+	int result                                 = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	libfcache_pending_load_t *pending_load     = NULL;
+	uint32_t current_generation                = 0;
+#endif
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( load_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load value function.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_cache_get_value_with_generation_by_identifier(
+	          cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          &expiry_timestamp,
+	          &generation,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* Concurrent misses on the same identifier are coalesced, only the first
+	 * thread loads the value and the other threads wait for its result
+	 */
+	result = libfcache_pending_loads_start_load(
+	          internal_cache->pending_loads,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &pending_load,
+	          cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to start load of value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* A load by another thread that finished after the lookup
+	 * can have set the value in the cache
+	 */
+	if( libfcache_internal_cache_get_generation(
+	     internal_cache,
+	     &current_generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve generation of cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( current_generation != generation )
+	{
+		result = libfcache_cache_get_value_with_generation_by_identifier(
+		          cache,
+		          file_index,
+		          offset,
+		          timestamp,
+		          cache_value,
+		          &expiry_timestamp,
+		          &generation,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value by identifier.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libfcache_pending_loads_finish_load(
+			     internal_cache->pending_loads,
+			     pending_load,
+			     *cache_value,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finish load of value.",
+				 function );
+
+				*cache_value = NULL;
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+#endif
+	if( load_value(
+	     load_data,
+	     file_index,
+	     offset,
+	     timestamp,
+	     &value,
+	     &value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to load value.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The index only needs to be probed again if the cache was modified
+	 * while the value was loaded
+	 */
+	result = 0;
+
+	if( generation != internal_cache->generation )
+	{
+		result = libfcache_internal_cache_get_value_by_identifier(
+		          internal_cache,
+		          file_index,
+		          offset,
+		          timestamp,
+		          cache_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value by identifier.",
+			 function );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libfcache_internal_cache_set_value_by_identifier(
+		          internal_cache,
+		          file_index,
+		          offset,
+		          timestamp,
+		          value,
+		          value_size,
+		          1,
+		          value_free_function,
+		          flags,
+		          NULL,
+		          NULL,
+		          cache_value,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cache value.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			/* The value is managed by the cache value from here on
+			 */
+			value = NULL;
+		}
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( value != NULL )
+	{
+		if( ( flags & LIBFCACHE_CACHE_VALUE_FLAG_MANAGED ) != 0 )
+		{
+			if( value_free_function == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing value free function.",
+				 function );
+
+				goto on_error;
+			}
+			if( value_free_function(
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	result = libfcache_pending_loads_finish_load(
+	          internal_cache->pending_loads,
+	          pending_load,
+	          *cache_value,
+	          1,
+	          error );
+
+	pending_load = NULL;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finish load of value.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( pending_load != NULL )
+	{
+		libfcache_pending_loads_finish_load(
+		 internal_cache->pending_loads,
+		 pending_load,
+		 NULL,
+		 -1,
+		 NULL );
+	}
+#endif
+	if( ( value != NULL )
+	 && ( ( flags & LIBFCACHE_CACHE_VALUE_FLAG_MANAGED ) != 0 )
+	 && ( value_free_function != NULL ) )
+	{
+		value_free_function(
+		 &value,
+		 NULL );
+	}
+	*cache_value = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves the cache value for the specific index
+ * An expired value is cleared before the cache value is returned
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_get_value_by_index(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_get_value_by_index";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( ( *cache_value != NULL )
+	 && ( ( (libfcache_internal_cache_value_t *) *cache_value )->expiry_timestamp != 0 ) )
+	{
+		if( libfcache_internal_cache_expire_value(
+		     internal_cache,
+		     cache_entry_index,
+		     *cache_value,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to expire cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache value for the specific index
+ * An expired value is cleared before the cache value is returned
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_get_value_by_index(
+     libfcache_cache_t *cache,
+     int cache_entry_index,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_get_value_by_index";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* Retrieving a cache value that does not expire does not change the cache
+	 * hence it only requires the lock for reading
+	 */
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		result = -1;
+	}
+	else if( ( *cache_value != NULL )
+	      && ( ( (libfcache_internal_cache_value_t *) *cache_value )->expiry_timestamp != 0 ) )
+	{
+		result = 0;
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		return( result );
+	}
+	/* A cache value that expires is retrieved again with the lock for writing
+	 * since it is cleared if expired
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfcache_internal_cache_get_value_by_index(
+	          internal_cache,
+	          cache_entry_index,
+	          cache_value,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Creates a cache value for a specific cache entry index
+ * The cache value is stored in the entries array and prepended to the used slots
+ * The cache value is taken from the preallocated cache values if available
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_create_cache_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *safe_cache_value              = NULL;
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_internal_cache_create_cache_value";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry_index < internal_cache->number_of_preallocated_values )
+	{
+		internal_cache_value = &( internal_cache->preallocated_values[ cache_entry_index ] );
+
+		if( memory_set(
+		     internal_cache_value,
+		     0,
+		     sizeof( libfcache_internal_cache_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear preallocated cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		internal_cache_value->file_index      = -1;
+		internal_cache_value->offset          = (off64_t) -1;
+		internal_cache_value->is_preallocated = 1;
+
+		safe_cache_value = (libfcache_cache_value_t *) internal_cache_value;
+	}
+	else if( libfcache_cache_value_initialize(
+	          &safe_cache_value,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_value_set_cache_index(
+	     safe_cache_value,
+	     cache_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache index in cache value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t *) safe_cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value: %d in entries array.",
+		 function,
+		 cache_entry_index );
+
+		goto on_error;
+	}
+	if( libfcache_slot_queues_prepend_slot(
+	     internal_cache->used_slots,
+	     LIBFCACHE_CACHE_QUEUE_USED,
+	     cache_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to prepend used slot: %d.",
+		 function,
+		 cache_entry_index );
+
+		libcdata_array_set_entry_by_index(
+		 internal_cache->entries_array,
+		 cache_entry_index,
+		 NULL,
+		 NULL );
+
+		goto on_error;
+	}
+	*cache_value = safe_cache_value;
+
+	return( 1 );
+
+on_error:
+	if( safe_cache_value != NULL )
+	{
+		libfcache_cache_value_free(
+		 &safe_cache_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Preallocates the cache values of the cache entries that do not have a cache value
+ * The preallocated cache values are added to the free slots so that they are reused first
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_preallocate_values(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_preallocate_values";
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_cache->entries_array,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries from entries array.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache->entries_array,
+		     cache_entry_index,
+		     (intptr_t **) &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d from entries array.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value != NULL )
+		{
+			continue;
+		}
+		if( libfcache_internal_cache_create_cache_value(
+		     internal_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		/* The free slots are reused from last to first
+		 */
+		if( libfcache_slot_queues_prepend_slot(
+		     internal_cache->free_slots,
+		     LIBFCACHE_CACHE_QUEUE_FREE,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend free slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Adds the cache entries that do not have a cache value to the free slots
+ * The free slots are reused from last to first hence the first unused cache entry is reused first
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_add_unused_free_slots(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_add_unused_free_slots";
+	uint8_t queue_number                 = 0;
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_cache->entries_array,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries from entries array.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache->entries_array,
+		     cache_entry_index,
+		     (intptr_t **) &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d from entries array.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value != NULL )
+		{
+			continue;
+		}
+		if( libfcache_slot_queues_get_queue_number(
+		     internal_cache->free_slots,
+		     cache_entry_index,
+		     &queue_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve queue number of free slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( queue_number == LIBFCACHE_CACHE_QUEUE_FREE )
+		{
+			continue;
+		}
+		if( libfcache_slot_queues_prepend_slot(
+		     internal_cache->free_slots,
+		     LIBFCACHE_CACHE_QUEUE_FREE,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend free slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the cache value for the specific index is pinned
+ * Returns 1 if pinned, 0 if not or -1 on error
+ */
+int libfcache_internal_cache_is_pinned(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_is_pinned";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( ( cache_value == NULL )
+	 || ( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count == 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the cache contains a pinned cache value from a specific index onwards
+ * Returns 1 if a pinned cache value was found, 0 if not or -1 on error
+ */
+int libfcache_internal_cache_has_pinned_values(
+     libfcache_internal_cache_t *internal_cache,
+     int first_cache_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfcache_internal_cache_has_pinned_values";
+	int cache_entry_index       = 0;
+	int number_of_cache_entries = 0;
+	int result                  = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_cache->entries_array,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries from entries array.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = first_cache_entry_index;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		result = libfcache_internal_cache_is_pinned(
+		          internal_cache,
+		          cache_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if cache value: %d is pinned.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Requeues the pinned cache value for the specific index in the replacement policy
+ * The cache value is removed and inserted again so that the policy selects another victim
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_requeue_pinned_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_requeue_pinned_value";
+	off64_t offset                       = 0;
+	int64_t timestamp                    = 0;
+	int file_index                       = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_get_identifier(
+	     cache_value,
+	     &file_index,
+	     &offset,
+	     &timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier of cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_policy_remove_slot(
+	     internal_cache->policy,
+	     cache_entry_index,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove cache value: %d from policy.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_policy_insert_slot(
+	     internal_cache->policy,
+	     cache_entry_index,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert cache value: %d in policy.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a cache value that can be reused to store a new value
+ * Creates the cache value if it does not exist, otherwise its identifier is removed from the index
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_get_reusable_cache_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *safe_cache_value = NULL;
+	static char *function                     = "libfcache_internal_cache_get_reusable_cache_value";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) &safe_cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( safe_cache_value == NULL )
+	{
+		if( libfcache_internal_cache_create_cache_value(
+		     internal_cache,
+		     cache_entry_index,
+		     &safe_cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libfcache_internal_cache_index_remove_slot(
+		     internal_cache,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove cache value: %d from index.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	*cache_value = safe_cache_value;
+
+	return( 1 );
+}
+
+/* Retrieves the cache entry index to reuse for a value that is not yet cached
+ * The value replaces the LRU value if its estimated frequency is higher,
+ * otherwise it replaces the value in the admission window
+ * On entry cache_entry_index contains the cache entry index of the last used slot
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_get_admission_cache_entry_index(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int *cache_entry_index,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	intptr_t *value                      = NULL;
+	static char *function                = "libfcache_internal_cache_get_admission_cache_entry_index";
+	off64_t victim_offset                = 0;
+	int64_t victim_timestamp             = 0;
+	uint8_t candidate_estimate           = 0;
+	uint8_t victim_estimate              = 0;
+	int result                           = 0;
+	int victim_file_index                = 0;
+	int victim_index                     = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry index.",
+		 function );
+
+		return( -1 );
+	}
+	victim_index = *cache_entry_index;
+
+	/* The admission window is not a victim, use the used slot before it
+	 */
+	if( victim_index == internal_cache->admission_window_index )
+	{
+		result = libfcache_slot_queues_get_previous_slot(
+		          internal_cache->used_slots,
+		          victim_index,
+		          &victim_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous used slot of slot: %d.",
+			 function,
+			 victim_index );
+
+			return( -1 );
+		}
+		/* If the cache contains a single value the admission window is reused
+		 */
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     victim_index,
+	     (intptr_t **) &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 victim_index );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache value.",
+		 function );
+
+		return( -1 );
+	}
+	/* A cleared cache value is always replaced
+	 */
+	if( value != NULL )
+	{
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &victim_file_index,
+		     &victim_offset,
+		     &victim_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier from cache value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfcache_frequency_sketch_get_estimate(
+		     internal_cache->frequency_sketch,
+		     file_index,
+		     offset,
+		     &candidate_estimate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve estimated frequency of value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfcache_frequency_sketch_get_estimate(
+		     internal_cache->frequency_sketch,
+		     victim_file_index,
+		     victim_offset,
+		     &victim_estimate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve estimated frequency of LRU value.",
+			 function );
+
+			return( -1 );
+		}
+		if( candidate_estimate <= victim_estimate )
+		{
+			if( internal_cache->admission_window_index == -1 )
+			{
+				internal_cache->admission_window_index = victim_index;
+			}
+			*cache_entry_index = internal_cache->admission_window_index;
+
+			return( 1 );
+		}
+	}
+	*cache_entry_index = victim_index;
+
+	return( 1 );
+}
+
+/* Frees the value of a cache value and clears the cache value
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_evict_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_evict_value";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
+
+	/* Free the value, if managed, since clearing the cache value does not
+	 */
+	if( libfcache_cache_value_set_value(
+	     cache_value,
+	     NULL,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value of cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_internal_cache_clear_value_by_index(
+	     internal_cache,
+	     cache_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Clears cache values until the cache size fits the maximum cache size
+ * The cache values are cleared in the order of the replacement policy
+ * The cache value of cache_entry_index, if not -1, is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_evict_values(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_evict_values";
+	uint8_t queue_number                 = 0;
+	int maximum_number_of_attempts       = 0;
+	int number_of_attempts               = 0;
+	int result                           = 0;
+	int used_slot                        = 0;
+	int victim_cache_entry_index         = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->policy == NULL )
+	{
+		result = libfcache_slot_queues_get_last_slot(
+		          internal_cache->used_slots,
+		          LIBFCACHE_CACHE_QUEUE_USED,
+		          &used_slot,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last used slot.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_cache->entries_array,
+		     &maximum_number_of_attempts,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache entries from entries array.",
+			 function );
+
+			return( -1 );
+		}
+		/* A policy can return the retained or cleared cache entries as victim
+		 * hence the number of attempts is limited to two passes over the cache entries
+		 */
+		maximum_number_of_attempts *= 2;
+	}
+	while( internal_cache->cache_size > internal_cache->maximum_cache_size )
+	{
+		if( internal_cache->policy == NULL )
+		{
+			if( result == 0 )
+			{
+				break;
+			}
+			victim_cache_entry_index = used_slot;
+
+			if( libcdata_array_get_entry_by_index(
+			     internal_cache->entries_array,
+			     victim_cache_entry_index,
+			     (intptr_t **) &cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value: %d from entries array.",
+				 function,
+				 victim_cache_entry_index );
+
+				return( -1 );
+			}
+			result = libfcache_slot_queues_get_previous_slot(
+			          internal_cache->used_slots,
+			          victim_cache_entry_index,
+			          &used_slot,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve previous used slot of slot: %d.",
+				 function,
+				 victim_cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( number_of_attempts >= maximum_number_of_attempts )
+			{
+				break;
+			}
+			number_of_attempts++;
+
+			if( libfcache_policy_get_victim_slot(
+			     internal_cache->policy,
+			     &victim_cache_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve victim cache entry index from policy.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdata_array_get_entry_by_index(
+			     internal_cache->entries_array,
+			     victim_cache_entry_index,
+			     (intptr_t **) &cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value: %d from entries array.",
+				 function,
+				 victim_cache_entry_index );
+
+				return( -1 );
+			}
+			/* Reference the retained cache entry so that the policy selects
+			 * another victim on the next attempt
+			 */
+			if( victim_cache_entry_index == cache_entry_index )
+			{
+				if( libfcache_policy_reference_slot(
+				     internal_cache->policy,
+				     victim_cache_entry_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to reference cache entry: %d in policy.",
+					 function,
+					 victim_cache_entry_index );
+
+					return( -1 );
+				}
+				continue;
+			}
+		}
+		if( ( cache_value == NULL )
+		 || ( victim_cache_entry_index == cache_entry_index ) )
+		{
+			continue;
+		}
+		if( libfcache_slot_queues_get_queue_number(
+		     internal_cache->free_slots,
+		     victim_cache_entry_index,
+		     &queue_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve queue number of free slot: %d.",
+			 function,
+			 victim_cache_entry_index );
+
+			return( -1 );
+		}
+		if( queue_number == LIBFCACHE_CACHE_QUEUE_FREE )
+		{
+			continue;
+		}
+		/* A pinned cache value is retained
+		 */
+		if( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count != 0 )
+		{
+			if( internal_cache->policy != NULL )
+			{
+				if( libfcache_internal_cache_requeue_pinned_value(
+				     internal_cache,
+				     victim_cache_entry_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to requeue pinned cache value: %d.",
+					 function,
+					 victim_cache_entry_index );
+
+					return( -1 );
+				}
+			}
+			continue;
+		}
+		if( libfcache_internal_cache_evict_value(
+		     internal_cache,
+		     victim_cache_entry_index,
+		     cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict cache value: %d.",
+			 function,
+			 victim_cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the current timestamp
+ * Within a batch the current timestamp retrieved at the start of the batch is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_get_current_timestamp(
+     libfcache_internal_cache_t *internal_cache,
+     int64_t *current_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_cache_get_current_timestamp";
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->batch_timestamp != 0 )
+	{
+		*current_timestamp = internal_cache->batch_timestamp;
+
+		return( 1 );
+	}
+	if( libfcache_date_time_get_timestamp(
+	     current_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the expiry timestamp of a cache value
+ * The expiry timestamp is the current timestamp plus the time-to-live,
+ * where a time-to-live of 0 represents a value that does not expire
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_set_expiry_timestamp(
+     libfcache_internal_cache_t *internal_cache,
+     libfcache_cache_value_t *cache_value,
+     int64_t time_to_live,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfcache_internal_cache_set_expiry_timestamp";
+	int64_t current_timestamp = 0;
+	int64_t expiry_timestamp  = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_to_live < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid time-to-live value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_to_live != 0 )
+	{
+		if( libfcache_internal_cache_get_current_timestamp(
+		     internal_cache,
+		     &current_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current timestamp.",
+			 function );
+
+			return( -1 );
+		}
+		if( current_timestamp > ( INT64_MAX - time_to_live ) )
+		{
+			expiry_timestamp = INT64_MAX;
+		}
+		else
+		{
+			expiry_timestamp = current_timestamp + time_to_live;
+		}
+	}
+	if( libfcache_cache_value_set_expiry_timestamp(
+	     cache_value,
+	     expiry_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set expiry timestamp in cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( expiry_timestamp != 0 )
+	 && ( ( internal_cache->next_expiry_timestamp == 0 )
+	  ||  ( expiry_timestamp < internal_cache->next_expiry_timestamp ) ) )
+	{
+		internal_cache->next_expiry_timestamp = expiry_timestamp;
+	}
+	return( 1 );
+}
+
+/* Clears a cache value if it expired
+ * Returns 1 if the cache value expired, 0 if not or -1 on error
+ */
+int libfcache_internal_cache_expire_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfcache_internal_cache_expire_value";
+	int64_t current_timestamp = 0;
+	int64_t expiry_timestamp  = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_get_expiry_timestamp(
+	     cache_value,
+	     &expiry_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve expiry timestamp from cache value.",
+		 function );
+
+		return( -1 );
+	}
+	/* A pinned cache value does not expire until it is released
+	 */
+	if( ( expiry_timestamp == 0 )
+	 || ( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfcache_internal_cache_get_current_timestamp(
+	     internal_cache,
+	     &current_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_timestamp < expiry_timestamp )
+	{
+		return( 0 );
+	}
+	if( libfcache_internal_cache_evict_value(
+	     internal_cache,
+	     cache_entry_index,
+	     cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Clears the cache values that expired
+ * The cache values are only checked once the first expiry timestamp has passed,
+ * the cleared cache entries are reused before other values are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_reclaim_expired_values(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_reclaim_expired_values";
+	int64_t current_timestamp            = 0;
+	int64_t expiry_timestamp             = 0;
+	int64_t next_expiry_timestamp        = 0;
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache->next_expiry_timestamp == 0 )
+	{
+		return( 1 );
+	}
+	if( libfcache_internal_cache_get_current_timestamp(
+	     internal_cache,
+	     &current_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_timestamp < internal_cache->next_expiry_timestamp )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_cache->entries_array,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries from entries array.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache->entries_array,
+		     cache_entry_index,
+		     (intptr_t **) &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d from entries array.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value == NULL )
+		{
+			continue;
+		}
+		if( libfcache_cache_value_get_expiry_timestamp(
+		     cache_value,
+		     &expiry_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve expiry timestamp from cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( expiry_timestamp == 0 )
+		{
+			continue;
+		}
+		if( ( current_timestamp >= expiry_timestamp )
+		 && ( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count == 0 ) )
+		{
+			if( libfcache_internal_cache_evict_value(
+			     internal_cache,
+			     cache_entry_index,
+			     cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to evict cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		else if( ( next_expiry_timestamp == 0 )
+		      || ( expiry_timestamp < next_expiry_timestamp ) )
+		{
+			next_expiry_timestamp = expiry_timestamp;
+		}
+	}
+	internal_cache->next_expiry_timestamp = next_expiry_timestamp;
+
+	return( 1 );
+}
+
+/* Sets the cache value for the file index, offset and timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_cache_set_value_by_identifier";
+
+	if( libfcache_cache_set_value_by_identifier_with_size(
+	     cache,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     0,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the cache value and its size for the file index, offset and timestamp
+ * If the cache has a maximum cache size other values are cleared until the cache size fits
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_value_by_identifier_with_size(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_cache_set_value_by_identifier_with_size";
+
+	if( libfcache_cache_set_value_by_identifier_with_cost(
+	     cache,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     value_size,
+	     1,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the cache value, its size and cost for the file index, offset and timestamp
+ * The cost is the cost to reload the value, which is used by GreedyDual-Size-Frequency
+ * replacement to retain values with a higher cost per byte, a cost of 0 is handled as 1
+ * If the cache has a maximum cache size other values are cleared until the cache size fits
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_value_by_identifier_with_cost(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_set_value_by_identifier_with_cost";
+	int result                                 = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_set_value_by_identifier(
+	     internal_cache,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     value_size,
+	     value_cost,
+	     value_free_function,
+	     flags,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the cache values and their sizes for the file indexes, offsets and timestamps
+ * The values are set in a single pass with the read/write lock grabbed once for writing
+ * value_sizes can be NULL if the values have no size
+ * If the cache has a maximum cache size other values are cleared until the cache size fits
+ * On error the values before the value that could not be set are set in the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_values_by_identifiers(
+     libfcache_cache_t *cache,
+     int number_of_values,
+     const int *file_indexes,
+     const off64_t *offsets,
+     const int64_t *timestamps,
+     intptr_t **values,
+     const size_t *value_sizes,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                      = "libfcache_cache_set_values_by_identifiers";
+	size_t value_size                          = 0;
+	int result                                 = 1;
+	int value_index                            = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamps.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The current timestamp is retrieved once for the batch and only if
+	 * the values that are set or the values in the cache can expire
+	 */
+	if( ( internal_cache->time_to_live != 0 )
+	 || ( internal_cache->next_expiry_timestamp != 0 ) )
+	{
+		if( libfcache_date_time_get_timestamp(
+		     &( internal_cache->batch_timestamp ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current timestamp.",
+			 function );
+
+			result = -1;
+		}
+	}
+	while( ( result != -1 )
+	    && ( value_index < number_of_values ) )
+	{
+		if( value_sizes != NULL )
+		{
+			value_size = value_sizes[ value_index ];
+		}
+		if( libfcache_internal_cache_set_value_by_identifier(
+		     internal_cache,
+		     file_indexes[ value_index ],
+		     offsets[ value_index ],
+		     timestamps[ value_index ],
+		     values[ value_index ],
+		     value_size,
+		     1,
+		     value_free_function,
+		     flags,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cache value: %d.",
+			 function,
+			 value_index );
+
+			result = -1;
+		}
+		value_index++;
+	}
+	internal_cache->batch_timestamp = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the cache value, its size and cost for the file index, offset and timestamp
+ * If replaced_value is not NULL the managed value of the cache entry that is reused
+ * is not freed but returned in replaced_value and replaced_value_size
+ * If stored_cache_value is not NULL the cache value that contains the value is returned
+ * in stored_cache_value
+ * On error the value is not set and the caller remains responsible for freeing it
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_set_value_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     intptr_t **replaced_value,
+     size_t *replaced_value_size,
+     libfcache_cache_value_t **stored_cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value                   = NULL;
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_internal_cache_set_value_by_identifier";
+	size_t previous_value_size                             = 0;
+	off64_t victim_offset                                  = 0;
+	int64_t victim_timestamp                               = 0;
+	int admission_cache_entry_index                        = 0;
+	int cache_entry_index                                  = 0;
+	int number_of_attempts                                 = 0;
+	int number_of_cache_entries                            = 0;
+	int result                                             = 0;
+	int victim_file_index                                  = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value free function is checked before the cache is modified
+	 */
+	if( ( flags & LIBFCACHE_CACHE_VALUE_FLAG_MANAGED ) != 0 )
+	{
+		if( value_free_function == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid value free function.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcdata_array_get_number_of_entries(
-	     internal_source_cache->entries_array,
+	     internal_cache->entries_array,
 	     &number_of_cache_entries,
 	     error ) != 1 )
 	{
@@ -321,38 +7344,565 @@ int libfcache_cache_clone(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries from source entries array.",
+		 "%s: unable to retrieve number of cache entries from entries array.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* The recorded hits are applied before a value to replace is determined
+	 */
+	if( libfcache_internal_cache_apply_hit_buffers(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to apply hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Expired values are cleared so that their cache entries are reused first
+	 */
+	if( libfcache_internal_cache_reclaim_expired_values(
+	     internal_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to reclaim expired cache values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reuse an unused cache entry or that of a cleared value before replacing another value
+	 */
+	result = libfcache_slot_queues_get_last_slot(
+	          internal_cache->free_slots,
+	          LIBFCACHE_CACHE_QUEUE_FREE,
+	          &cache_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last free slot.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_slot_queues_remove_slot(
+		     internal_cache->free_slots,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove free slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libfcache_internal_cache_get_reusable_cache_value(
+		     internal_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve reusable cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	else if( internal_cache->policy != NULL )
+	{
+		/* A pinned cache value is requeued so that the policy selects another victim,
+		 * the number of attempts is limited to two passes over the cache entries
+		 */
+		for( number_of_attempts = 0;
+		     number_of_attempts < ( 2 * number_of_cache_entries );
+		     number_of_attempts++ )
+		{
+			if( libfcache_policy_get_victim_slot(
+			     internal_cache->policy,
+			     &cache_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve victim cache entry index from policy.",
+				 function );
+
+				return( -1 );
+			}
+			result = libfcache_internal_cache_is_pinned(
+			          internal_cache,
+			          cache_entry_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if cache value: %d is pinned.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libfcache_internal_cache_requeue_pinned_value(
+			     internal_cache,
+			     cache_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to requeue pinned cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		if( result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: unable to find cache value that is not pinned.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfcache_internal_cache_get_reusable_cache_value(
+		     internal_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve reusable cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &victim_file_index,
+		     &victim_offset,
+		     &victim_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier of cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libfcache_policy_remove_slot(
+		     internal_cache->policy,
+		     cache_entry_index,
+		     victim_file_index,
+		     victim_offset,
+		     victim_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove cache value: %d from policy.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		result = libfcache_slot_queues_get_last_slot(
+		          internal_cache->used_slots,
+		          LIBFCACHE_CACHE_QUEUE_USED,
+		          &cache_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last used slot.",
+			 function );
+
+			return( -1 );
+		}
+		/* A pinned cache value is skipped in favor of the next least recently used value
+		 */
+		while( result == 1 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_cache->entries_array,
+			     cache_entry_index,
+			     (intptr_t **) &cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value: %d from entries array.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			if( ( (libfcache_internal_cache_value_t *) cache_value )->pin_count == 0 )
+			{
+				break;
+			}
+			result = libfcache_slot_queues_get_previous_slot(
+			          internal_cache->used_slots,
+			          cache_entry_index,
+			          &cache_entry_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve previous used slot of slot: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: unable to find cache value that is not pinned.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_cache->frequency_sketch != NULL )
+		{
+			admission_cache_entry_index = cache_entry_index;
+
+			if( libfcache_internal_cache_get_admission_cache_entry_index(
+			     internal_cache,
+			     file_index,
+			     offset,
+			     &admission_cache_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve admission cache entry index.",
+				 function );
+
+				return( -1 );
+			}
+			result = libfcache_internal_cache_is_pinned(
+			          internal_cache,
+			          admission_cache_entry_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if cache value: %d is pinned.",
+				 function,
+				 admission_cache_entry_index );
+
+				return( -1 );
+			}
+			/* A pinned admission window is not replaced, use the LRU value instead
+			 */
+			else if( result == 0 )
+			{
+				cache_entry_index = admission_cache_entry_index;
+			}
+		}
+		if( libfcache_internal_cache_get_reusable_cache_value(
+		     internal_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve reusable cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( libfcache_cache_value_set_identifier(
+	     cache_value,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set identifier in cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_get_value_size(
+	     cache_value,
+	     &previous_value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value size from cache value.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     destination_cache,
-	     number_of_cache_entries,
+	/* The managed value that is replaced is handed off instead of freed
+	 */
+	if( replaced_value != NULL )
+	{
+		internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+		if( ( ( internal_cache_value->flags & LIBFCACHE_CACHE_VALUE_FLAG_MANAGED ) != 0 )
+		 && ( internal_cache_value->value != NULL )
+		 && ( internal_cache_value->value != value ) )
+		{
+			*replaced_value      = internal_cache_value->value;
+			*replaced_value_size = previous_value_size;
+
+			internal_cache_value->value  = NULL;
+			internal_cache_value->flags &= ~( LIBFCACHE_CACHE_VALUE_FLAG_MANAGED );
+		}
+	}
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
+
+	if( libfcache_cache_value_set_value_size(
+	     cache_value,
+	     value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value size in cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache->cache_size -= previous_value_size;
+	internal_cache->cache_size += value_size;
+
+	if( libfcache_internal_cache_set_expiry_timestamp(
+	     internal_cache,
+	     cache_value,
+	     internal_cache->time_to_live,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set expiry timestamp of cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_internal_cache_index_insert_slot(
+	     internal_cache,
+	     cache_entry_index,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert cache value: %d into index.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( ( internal_cache->flags & LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT ) != 0 )
+	{
+		if( libfcache_greedy_dual_set_slot_cost(
+		     (libfcache_greedy_dual_t *) internal_cache->policy->policy_data,
+		     cache_entry_index,
+		     value_size,
+		     value_cost,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cost of cache value: %d in policy.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( internal_cache->policy != NULL )
+	{
+		if( libfcache_policy_insert_slot(
+		     internal_cache->policy,
+		     cache_entry_index,
+		     file_index,
+		     offset,
+		     timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert cache value: %d into policy.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_cache->maximum_cache_size != 0 )
+	 && ( internal_cache->cache_size > internal_cache->maximum_cache_size ) )
+	{
+		if( libfcache_internal_cache_evict_values(
+		     internal_cache,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict cache values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The value is set last so that on error it remains managed by the caller
+	 */
+	if( libfcache_cache_value_set_value(
+	     cache_value,
+	     value,
+	     value_free_function,
+	     flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination cache.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value in cache value.",
 		 function );
 
 		return( -1 );
 	}
+	if( stored_cache_value != NULL )
+	{
+		*stored_cache_value = cache_value;
+	}
 	return( 1 );
 }
 
-/* Resizes the cache
+/* Sets the cache value, its size and cost for the file index, offset and timestamp
+ * and retrieves the value it replaces
+ * The managed value of the cache entry that is reused is not freed but returned
+ * in replaced_value, so that its buffer can be recycled for a next value,
+ * replaced_value is set to NULL if no managed value was replaced
+ * Other values that are cleared until the cache size fits are freed
+ * The caller takes over management of the replaced value, also on error
  * Returns 1 if successful or -1 on error
  */
-int libfcache_cache_resize(
+int libfcache_cache_exchange_value_by_identifier(
      libfcache_cache_t *cache,
-     int maximum_cache_entries,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     intptr_t **replaced_value,
+     size_t *replaced_value_size,
      libcerror_error_t **error )
 {
 	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_resize";
+	static char *function                      = "libfcache_cache_exchange_value_by_identifier";
+	int result                                 = 1;
 
 	if( cache == NULL )
 	{
@@ -367,117 +7917,479 @@ int libfcache_cache_resize(
 	}
 	internal_cache = (libfcache_internal_cache_t *) cache;
 
-	if( libcdata_array_resize(
-	     internal_cache->entries_array,
-	     maximum_cache_entries,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+	if( replaced_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replaced value.",
+		 function );
+
+		return( -1 );
+	}
+	if( replaced_value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replaced value size.",
+		 function );
+
+		return( -1 );
+	}
+	*replaced_value      = NULL;
+	*replaced_value_size = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize entries array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_set_value_by_identifier(
+	     internal_cache,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     value_size,
+	     value_cost,
+	     value_free_function,
+	     flags,
+	     replaced_value,
+	     replaced_value_size,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
+	return( result );
+}
+
+/* Sets the cache value for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_value_by_index(
+     libfcache_cache_t *cache,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_cache_set_value_by_index";
+
+	if( libfcache_cache_set_value_by_index_with_size(
+	     cache,
+	     cache_entry_index,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     0,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves the number of entries of the cache
+/* Sets the cache value and its size for the specific index
+ * If the cache has a maximum cache size other values are cleared until the cache size fits
  * Returns 1 if successful or -1 on error
  */
-int libfcache_cache_get_number_of_entries(
+int libfcache_cache_set_value_by_index_with_size(
      libfcache_cache_t *cache,
-     int *number_of_entries,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
      libcerror_error_t **error )
 {
-	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_get_number_of_entries";
+	static char *function = "libfcache_cache_set_value_by_index_with_size";
+
+	if( libfcache_cache_set_value_by_index_with_cost(
+	     cache,
+	     cache_entry_index,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     value_size,
+	     1,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the cache value, its size and cost for the specific index
+ * The cost is the cost to reload the value, which is used by GreedyDual-Size-Frequency
+ * replacement to retain values with a higher cost per byte, a cost of 0 is handled as 1
+ * If the cache has a maximum cache size other values are cleared until the cache size fits
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_cache_set_value_by_index_with_cost(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_set_value_by_index_with_cost";
+	size_t previous_value_size           = 0;
+	uint8_t queue_number                 = 0;
+	int result                           = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_internal_cache_is_pinned(
+	          internal_cache,
+	          cache_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if cache value: %d is pinned.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to replace pinned cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_get_queue_number(
+	     internal_cache->free_slots,
+	     cache_entry_index,
+	     &queue_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve queue number of free slot: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( queue_number == LIBFCACHE_CACHE_QUEUE_FREE )
+	{
+		if( libfcache_slot_queues_remove_slot(
+		     internal_cache->free_slots,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove free slot: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( libfcache_internal_cache_get_reusable_cache_value(
+	     internal_cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve reusable cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_get_value_size(
+	     cache_value,
+	     &previous_value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value size from cache value.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
+
+	if( libfcache_cache_value_set_value(
+	     cache_value,
+	     value,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value in cache value.",
+		 function );
 
-	if( cache == NULL )
+		return( -1 );
+	}
+	if( libfcache_cache_value_set_value_size(
+	     cache_value,
+	     value_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid cache.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value size in cache value.",
 		 function );
 
 		return( -1 );
 	}
-	internal_cache = (libfcache_internal_cache_t *) cache;
+	internal_cache->cache_size -= previous_value_size;
+	internal_cache->cache_size += value_size;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_cache->entries_array,
-	     number_of_entries,
+	if( libfcache_internal_cache_set_expiry_timestamp(
+	     internal_cache,
+	     cache_value,
+	     internal_cache->time_to_live,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from entries array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set expiry timestamp of cache value.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the number of cache values
- * Returns 1 if successful or -1 on error
- */
-int libfcache_cache_get_number_of_cache_values(
-     libfcache_cache_t *cache,
-     int *number_of_cache_values,
-     libcerror_error_t **error )
-{
-	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_get_number_of_cache_values";
-
-	if( cache == NULL )
+	if( libfcache_cache_value_set_identifier(
+	     cache_value,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid cache.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set identifier in cache value.",
 		 function );
 
 		return( -1 );
 	}
-	internal_cache = (libfcache_internal_cache_t *) cache;
-
-	if( libcdata_list_get_number_of_elements(
-	     internal_cache->entries_list,
-	     number_of_cache_values,
+	if( libfcache_internal_cache_index_insert_slot(
+	     internal_cache,
+	     cache_entry_index,
+	     file_index,
+	     offset,
+	     timestamp,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from entries list.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert cache value: %d into index.",
+		 function,
+		 cache_entry_index );
 
 		return( -1 );
 	}
+	if( ( internal_cache->flags & LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT ) != 0 )
+	{
+		if( libfcache_greedy_dual_set_slot_cost(
+		     (libfcache_greedy_dual_t *) internal_cache->policy->policy_data,
+		     cache_entry_index,
+		     value_size,
+		     value_cost,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cost of cache value: %d in policy.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( internal_cache->policy != NULL )
+	{
+		if( libfcache_policy_insert_slot(
+		     internal_cache->policy,
+		     cache_entry_index,
+		     file_index,
+		     offset,
+		     timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert cache value: %d into policy.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_cache->maximum_cache_size != 0 )
+	 && ( internal_cache->cache_size > internal_cache->maximum_cache_size ) )
+	{
+		if( libfcache_internal_cache_evict_values(
+		     internal_cache,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict cache values.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-/* Clears the cache value for the specific index
+/* Sets the cache value, its size and cost for the specific index
+ * The cost is the cost to reload the value, which is used by GreedyDual-Size-Frequency
+ * replacement to retain values with a higher cost per byte, a cost of 0 is handled as 1
+ * If the cache has a maximum cache size other values are cleared until the cache size fits
  * Returns 1 if successful or -1 on error
  */
-int libfcache_cache_clear_value_by_index(
+int libfcache_cache_set_value_by_index_with_cost(
      libfcache_cache_t *cache,
      int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value       = NULL;
 	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_clear_value_by_index";
+	static char *function                      = "libfcache_cache_set_value_by_index_with_cost";
+	int result                                 = 1;
 
 	if( cache == NULL )
 	{
@@ -492,60 +8404,81 @@ int libfcache_cache_clear_value_by_index(
 	}
 	internal_cache = (libfcache_internal_cache_t *) cache;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_cache->entries_array,
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfcache_internal_cache_set_value_by_index_with_cost(
+	     internal_cache,
 	     cache_entry_index,
-	     (intptr_t **) &cache_value,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     value_size,
+	     value_cost,
+	     value_free_function,
+	     flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache value: %d from entries array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value: %d.",
 		 function,
 		 cache_entry_index );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libfcache_cache_value_clear(
-	     cache_value,
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to clear cache value.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the cache value that matches the file index, offset and timestamp
+/* Sets the time-to-live of the cache value that matches the file index, offset and timestamp
+ * The time-to-live overrides the time-to-live of the cache, where 0 represents
+ * a value that does not expire
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libfcache_cache_get_value_by_identifier(
-     libfcache_cache_t *cache,
+int libfcache_internal_cache_set_value_time_to_live_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
      int file_index,
      off64_t offset,
      int64_t timestamp,
-     libfcache_cache_value_t **cache_value,
+     int64_t time_to_live,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element      = NULL;
-	libfcache_cache_value_t *safe_cache_value  = NULL;
-	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_get_value_by_identifier";
-	off64_t cache_value_offset                 = 0;
-	int64_t cache_value_timestamp              = 0;
-	int cache_value_file_index                 = 0;
-	int number_of_cache_values                 = 0;
-	int result                                 = 0;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfcache_internal_cache_set_value_time_to_live_by_identifier";
+	int cache_entry_index                = 0;
+	int result                           = 0;
 
-	if( cache == NULL )
+	if( internal_cache == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -556,206 +8489,174 @@ int libfcache_cache_get_value_by_identifier(
 
 		return( -1 );
 	}
-	internal_cache = (libfcache_internal_cache_t *) cache;
-
-	if( cache_value == NULL )
+	if( time_to_live < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid cache value.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid time-to-live value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	*cache_value = NULL;
+	result = libfcache_internal_cache_index_get_slot_by_identifier(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &cache_entry_index,
+	          error );
 
-	if( libcdata_list_get_number_of_elements(
-	     internal_cache->entries_list,
-	     &number_of_cache_values,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from entries list.",
+		 "%s: unable to retrieve cache entry index by identifier from index.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     internal_cache->entries_list,
-	     &list_element,
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_cache->entries_array,
+	     cache_entry_index,
+	     (intptr_t **) &cache_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
-		 function );
+		 "%s: unable to retrieve cache value: %d from entries array.",
+		 function,
+		 cache_entry_index );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) &safe_cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value from list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfcache_cache_value_get_identifier(
-		     safe_cache_value,
-		     &cache_value_file_index,
-		     &cache_value_offset,
-		     &cache_value_timestamp,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value identifier.",
-			 function );
-
-			return( -1 );
-		}
-		if( ( cache_value_file_index == file_index )
-		 && ( cache_value_offset == offset )
-		 && ( cache_value_timestamp == timestamp ) )
-		{
-			result = 1;
-
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
+	libfcache_internal_cache_increment_generation(
+	 internal_cache );
 
-			return( -1 );
-		}
-	}
-	if( ( result != 0 )
-	 && ( number_of_cache_values > 0 ) )
+	if( libfcache_internal_cache_set_expiry_timestamp(
+	     internal_cache,
+	     cache_value,
+	     time_to_live,
+	     error ) != 1 )
 	{
-		if( libcdata_list_remove_element(
-		     internal_cache->entries_list,
-		     list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_list_prepend_element(
-		     internal_cache->entries_list,
-		     list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to prepend list element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set expiry timestamp of cache value: %d.",
+		 function,
+		 cache_entry_index );
 
-			return( -1 );
-		}
-		*cache_value = safe_cache_value;
+		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the cache value for the specific index
- * Returns 1 if successful or -1 on error
+/* Sets the time-to-live of the cache value that matches the file index, offset and timestamp
+ * The time-to-live overrides the time-to-live of the cache, where 0 represents
+ * a value that does not expire
+ * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libfcache_cache_get_value_by_index(
+int libfcache_cache_set_value_time_to_live_by_identifier(
      libfcache_cache_t *cache,
-     int cache_entry_index,
-     libfcache_cache_value_t **cache_value,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int64_t time_to_live,
      libcerror_error_t **error )
 {
 	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_get_value_by_index";
+	static char *function                      = "libfcache_cache_set_value_time_to_live_by_identifier";
+	int result                                 = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
 
-	if( cache == NULL )
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid cache.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_cache = (libfcache_internal_cache_t *) cache;
+#endif
+	result = libfcache_internal_cache_set_value_time_to_live_by_identifier(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          time_to_live,
+	          error );
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_cache->entries_array,
-	     cache_entry_index,
-	     (intptr_t **) cache_value,
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time-to-live of cache value.",
+		 function );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache value: %d from entries array.",
-		 function,
-		 cache_entry_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Sets the cache value for the file index, offset and timestamp
- * Returns 1 if successful or -1 on error
+/* Acquires the cache value that matches the file index, offset and timestamp
+ * The cache value is pinned, a pinned cache value is not replaced, cleared or expired
+ * until it is released with libfcache_cache_release_value
+ * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libfcache_cache_set_value_by_identifier(
+int libfcache_cache_acquire_value_by_identifier(
      libfcache_cache_t *cache,
      int file_index,
      off64_t offset,
      int64_t timestamp,
-     intptr_t *value,
-     int (*value_free_function)(
-            intptr_t **value,
-            libcerror_error_t **error ),
-     uint8_t flags,
+     libfcache_cache_value_t **cache_value,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element      = NULL;
-	libfcache_cache_value_t *cache_value       = NULL;
 	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_set_value_by_identifier";
-	int cache_entry_index                      = 0;
-	int number_of_cache_entries                = 0;
-	int number_of_cache_values                 = 0;
+	static char *function                      = "libfcache_cache_acquire_value_by_identifier";
+	int result                                 = 0;
 
 	if( cache == NULL )
 	{
@@ -770,219 +8671,89 @@ int libfcache_cache_set_value_by_identifier(
 	}
 	internal_cache = (libfcache_internal_cache_t *) cache;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_cache->entries_array,
-	     &number_of_cache_entries,
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries from entries array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     internal_cache->entries_list,
-	     &number_of_cache_values,
-	     error ) != 1 )
+#endif
+	result = libfcache_internal_cache_get_value_by_identifier(
+	          internal_cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from entries list.",
+		 "%s: unable to retrieve cache value by identifier.",
 		 function );
-
-		return( -1 );
 	}
-	if( number_of_cache_values < number_of_cache_entries )
+	/* The cache value is pinned before the lock is released so that
+	 * it cannot be replaced by another thread in between
+	 */
+	else if( result != 0 )
 	{
-		cache_entry_index = number_of_cache_values;
-
-		if( libfcache_cache_value_initialize(
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create cache value.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfcache_cache_value_set_cache_index(
-		     cache_value,
-		     cache_entry_index,
+		if( libfcache_cache_value_pin(
+		     *cache_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set cache index in cache value.",
+			 "%s: unable to pin cache value.",
 			 function );
 
-			libfcache_cache_value_free(
-			 &cache_value,
-			 NULL );
-
-			return( -1 );
-		}
-		if( libcdata_array_set_entry_by_index(
-		     internal_cache->entries_array,
-		     cache_entry_index,
-		     (intptr_t *) cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set cache value: %d in entries array.",
-			 function,
-			 cache_entry_index );
-
-			libfcache_cache_value_free(
-			 &cache_value,
-			 NULL );
-
-			return( -1 );
-		}
-		if( libcdata_list_prepend_value(
-		     internal_cache->entries_list,
-		     (intptr_t *) cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to prepend cache value: %d to entries list.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	else
-	{
-		if( libcdata_list_get_last_element(
-		     internal_cache->entries_list,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value from list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfcache_cache_value_get_cache_index(
-		     cache_value,
-		     &cache_entry_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache index from cache value.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_array_get_entry_by_index(
-		     internal_cache->entries_array,
-		     cache_entry_index,
-		     (intptr_t **) &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d from entries array.",
-			 function,
-			 cache_entry_index );
-
-			return( -1 );
+			*cache_value = NULL;
+			result       = -1;
 		}
 	}
-	if( libfcache_cache_value_set_identifier(
-	     cache_value,
-	     file_index,
-	     offset,
-	     timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set identifier in cache value.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfcache_cache_value_set_value(
-	     cache_value,
-	     value,
-	     value_free_function,
-	     flags,
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value in cache value.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Sets the cache value for the specific index
+/* Releases a cache value that was acquired
  * Returns 1 if successful or -1 on error
  */
-int libfcache_cache_set_value_by_index(
+int libfcache_cache_release_value(
      libfcache_cache_t *cache,
-     int cache_entry_index,
-     int file_index,
-     off64_t offset,
-     int64_t timestamp,
-     intptr_t *value,
-     int (*value_free_function)(
-            intptr_t **value,
-            libcerror_error_t **error ),
-     uint8_t flags,
+     libfcache_cache_value_t *cache_value,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value       = NULL;
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
 	libfcache_internal_cache_t *internal_cache = NULL;
-	static char *function                      = "libfcache_cache_set_value_by_index";
+#endif
+	static char *function                      = "libfcache_cache_release_value";
+	int result                                 = 1;
 
 	if( cache == NULL )
 	{
@@ -995,124 +8766,51 @@ int libfcache_cache_set_value_by_index(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
 	internal_cache = (libfcache_internal_cache_t *) cache;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_cache->entries_array,
-	     cache_entry_index,
-	     (intptr_t **) &cache_value,
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache value: %d from entries array.",
-		 function,
-		 cache_entry_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	if( cache_value == NULL )
-	{
-		if( libfcache_cache_value_initialize(
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create cache value.",
-			 function );
-
-			return( -1 );
-		}
-		if( libfcache_cache_value_set_cache_index(
-		     cache_value,
-		     cache_entry_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set cache index in cache value.",
-			 function );
-
-			libfcache_cache_value_free(
-			 &cache_value,
-			 NULL );
-
-			return( -1 );
-		}
-		if( libcdata_array_set_entry_by_index(
-		     internal_cache->entries_array,
-		     cache_entry_index,
-		     (intptr_t *) cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set cache value: %d in entries array.",
-			 function,
-			 cache_entry_index );
-
-			libfcache_cache_value_free(
-			 &cache_value,
-			 NULL );
-
-			return( -1 );
-		}
-		if( libcdata_list_prepend_value(
-		     internal_cache->entries_list,
-		     (intptr_t *) cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to prepend cache value: %d to entries list.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( libfcache_cache_value_set_value(
+#endif
+	if( libfcache_cache_value_unpin(
 	     cache_value,
-	     value,
-	     value_free_function,
-	     flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value in cache value.",
+		 "%s: unable to unpin cache value.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libfcache_cache_value_set_identifier(
-	     cache_value,
-	     file_index,
-	     offset,
-	     timestamp,
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set identifier in cache value.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
@@ -27,8 +27,18 @@
 
 #include "libfcache_cache_value.h"
 #include "libfcache_extern.h"
+#include "libfcache_file_slots.h"
+#include "libfcache_flat_table.h"
+#include "libfcache_frequency_sketch.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_hit_buffers.h"
 #include "libfcache_libcdata.h"
 #include "libfcache_libcerror.h"
+#include "libfcache_libcthreads.h"
+#include "libfcache_linear_table.h"
+#include "libfcache_pending_loads.h"
+#include "libfcache_policy.h"
+#include "libfcache_slot_queues.h"
 #include "libfcache_types.h"
 
 #if defined( __cplusplus )
@@ -43,13 +53,96 @@ struct libfcache_internal_cache
 	 */
 	libcdata_array_t *entries_array;
 
-	/* The cache entries list
+	/* The used slots, the cache entries that contain a cache value
+	 * ordered from most to least recently used
 	 */
-	libcdata_list_t *entries_list;
+	libfcache_slot_queues_t *used_slots;
 
-	/* The number of cache values
+	/* The hash table that maps identifiers to cache entries
 	 */
-	int number_of_cache_values;
+	libfcache_hash_table_t *hash_table;
+
+	/* The flat table that maps identifiers to cache entries
+	 */
+	libfcache_flat_table_t *flat_table;
+
+	/* The linear table that maps identifiers to cache entries
+	 */
+	libfcache_linear_table_t *linear_table;
+
+	/* The file slots that map file indexes to cache entries
+	 */
+	libfcache_file_slots_t *file_slots;
+
+	/* The free slots, the cache entries of which the value was cleared
+	 */
+	libfcache_slot_queues_t *free_slots;
+
+	/* The replacement policy, contains NULL if the cache uses LRU replacement
+	 */
+	libfcache_policy_t *policy;
+
+	/* The frequency sketch used for frequency admission
+	 */
+	libfcache_frequency_sketch_t *frequency_sketch;
+
+	/* The cache entry index of the admission window, the value that was
+	 * not admitted most recently, contains -1 if not set
+	 */
+	int admission_window_index;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The maximum cache size in bytes, contains 0 if not set
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache size, the total size of the cache values in bytes
+	 */
+	size64_t cache_size;
+
+	/* The time-to-live of the values that are set, contains 0 if not set
+	 */
+	int64_t time_to_live;
+
+	/* The expiry timestamp of the value that expires first, contains 0 if no value expires
+	 */
+	int64_t next_expiry_timestamp;
+
+	/* The current timestamp of a batch of lookups or values that are set,
+	 * contains 0 if the current timestamp is retrieved by every lookup or value that is set
+	 */
+	int64_t batch_timestamp;
+
+	/* The generation, which is incremented every time the index is modified
+	 * or a value is stored, evicted or its expiry changed
+	 */
+	uint32_t generation;
+
+	/* The preallocated cache values, contains NULL if not set
+	 */
+	libfcache_internal_cache_value_t *preallocated_values;
+
+	/* The number of preallocated cache values
+	 */
+	int number_of_preallocated_values;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The hit buffers, the hits recorded while holding the read lock
+	 * that are applied while holding the write lock
+	 */
+	libfcache_hit_buffers_t *hit_buffers;
+
+	/* The pending loads, the values that are being loaded by a read-through lookup
+	 */
+	libfcache_pending_loads_t *pending_loads;
+#endif
 };
 
 LIBFCACHE_EXTERN \
@@ -58,11 +151,66 @@ int libfcache_cache_initialize(
      int maximum_cache_entries,
      libcerror_error_t **error );
 
+LIBFCACHE_EXTERN \
+int libfcache_cache_initialize_with_flags(
+     libfcache_cache_t **cache,
+     int maximum_cache_entries,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_initialize_with_policy(
+     libfcache_cache_t **cache,
+     int maximum_cache_entries,
+     uint8_t flags,
+     intptr_t *policy_data,
+     int (*free_policy_data)(
+            intptr_t **policy_data,
+            libcerror_error_t **error ),
+     int (*clone_policy_data)(
+            intptr_t **destination_policy_data,
+            intptr_t *source_policy_data,
+            libcerror_error_t **error ),
+     int (*clear_policy_data)(
+            intptr_t *policy_data,
+            libcerror_error_t **error ),
+     int (*resize_policy_data)(
+            intptr_t *policy_data,
+            int number_of_slots,
+            libcerror_error_t **error ),
+     int (*insert_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*reference_slot)(
+            intptr_t *policy_data,
+            int slot,
+            libcerror_error_t **error ),
+     int (*remove_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*get_victim_slot)(
+            intptr_t *policy_data,
+            int *slot,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_free(
      libfcache_cache_t **cache,
      libcerror_error_t **error );
 
+int libfcache_internal_cache_empty(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_empty(
      libfcache_cache_t *cache,
@@ -74,12 +222,52 @@ int libfcache_cache_clone(
      libfcache_cache_t *source_cache,
      libcerror_error_t **error );
 
+int libfcache_internal_cache_resize(
+     libfcache_internal_cache_t *internal_cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_resize(
      libfcache_cache_t *cache,
      int maximum_cache_entries,
      libcerror_error_t **error );
 
+int libfcache_internal_cache_get_generation(
+     libfcache_internal_cache_t *internal_cache,
+     uint32_t *generation,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_index_clear(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_index_resize(
+     libfcache_internal_cache_t *internal_cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_index_get_slot_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *cache_entry_index,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_index_insert_slot(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_index_remove_slot(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_get_number_of_entries(
      libfcache_cache_t *cache,
@@ -92,12 +280,127 @@ int libfcache_cache_get_number_of_cache_values(
      int *number_of_values,
      libcerror_error_t **error );
 
+LIBFCACHE_EXTERN \
+int libfcache_cache_get_maximum_cache_size(
+     libfcache_cache_t *cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_maximum_cache_size(
+     libfcache_cache_t *cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_get_cache_size(
+     libfcache_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_get_time_to_live(
+     libfcache_cache_t *cache,
+     int64_t *time_to_live,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_time_to_live(
+     libfcache_cache_t *cache,
+     int64_t time_to_live,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_clear_value_by_index(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_clear_value_by_index(
      libfcache_cache_t *cache,
      int cache_entry_index,
      libcerror_error_t **error );
 
+int libfcache_internal_cache_invalidate_file(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_invalidate_file(
+     libfcache_cache_t *cache,
+     int file_index,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_invalidate_range(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_invalidate_range(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_iterate_values_in_range(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*callback_function)(
+            libfcache_cache_value_t *cache_value,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_iterate_values_in_range(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*callback_function)(
+            libfcache_cache_value_t *cache_value,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+
+int libfcache_internal_cache_apply_hit_buffers(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) */
+
+int libfcache_internal_cache_get_value_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+
+int libfcache_internal_cache_get_value_by_identifier_for_read(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     uint8_t *requires_write,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) */
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_get_value_by_identifier(
      libfcache_cache_t *cache,
@@ -107,6 +410,55 @@ int libfcache_cache_get_value_by_identifier(
      libfcache_cache_value_t **cache_value,
      libcerror_error_t **error );
 
+LIBFCACHE_EXTERN \
+int libfcache_cache_get_values_by_identifiers(
+     libfcache_cache_t *cache,
+     int number_of_identifiers,
+     const int *file_indexes,
+     const off64_t *offsets,
+     const int64_t *timestamps,
+     libfcache_cache_value_t **cache_values,
+     int *number_of_hits,
+     libcerror_error_t **error );
+
+int libfcache_cache_get_value_with_generation_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     int64_t *expiry_timestamp,
+     uint32_t *generation,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_get_or_load_value(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int (*load_value)(
+            intptr_t *load_data,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            intptr_t **value,
+            size_t *value_size,
+            libcerror_error_t **error ),
+     intptr_t *load_data,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_get_value_by_index(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_get_value_by_index(
      libfcache_cache_t *cache,
@@ -114,6 +466,97 @@ int libfcache_cache_get_value_by_index(
      libfcache_cache_value_t **cache_value,
      libcerror_error_t **error );
 
+int libfcache_internal_cache_create_cache_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_preallocate_values(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_add_unused_free_slots(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_is_pinned(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_has_pinned_values(
+     libfcache_internal_cache_t *internal_cache,
+     int first_cache_entry_index,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_requeue_pinned_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_get_reusable_cache_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_get_admission_cache_entry_index(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int *cache_entry_index,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_evict_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_evict_values(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_get_current_timestamp(
+     libfcache_internal_cache_t *internal_cache,
+     int64_t *current_timestamp,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_set_expiry_timestamp(
+     libfcache_internal_cache_t *internal_cache,
+     libfcache_cache_value_t *cache_value,
+     int64_t time_to_live,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_expire_value(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_reclaim_expired_values(
+     libfcache_internal_cache_t *internal_cache,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_set_value_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     intptr_t **replaced_value,
+     size_t *replaced_value_size,
+     libfcache_cache_value_t **stored_cache_value,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_set_value_by_identifier(
      libfcache_cache_t *cache,
@@ -127,6 +570,67 @@ int libfcache_cache_set_value_by_identifier(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_value_by_identifier_with_size(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_value_by_identifier_with_cost(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_values_by_identifiers(
+     libfcache_cache_t *cache,
+     int number_of_values,
+     const int *file_indexes,
+     const off64_t *offsets,
+     const int64_t *timestamps,
+     intptr_t **values,
+     const size_t *value_sizes,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_exchange_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     intptr_t **replaced_value,
+     size_t *replaced_value_size,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_set_value_by_index(
      libfcache_cache_t *cache,
@@ -141,6 +645,84 @@ int libfcache_cache_set_value_by_index(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_value_by_index_with_size(
+     libfcache_cache_t *cache,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_set_value_by_index_with_cost(
+     libfcache_internal_cache_t *internal_cache,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_value_by_index_with_cost(
+     libfcache_cache_t *cache,
+     int cache_entry_index,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfcache_internal_cache_set_value_time_to_live_by_identifier(
+     libfcache_internal_cache_t *internal_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int64_t time_to_live,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_value_time_to_live_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int64_t time_to_live,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_acquire_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_release_value(
+     libfcache_cache_t *cache,
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
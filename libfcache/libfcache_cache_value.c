@@ -162,8 +162,11 @@ int libfcache_cache_value_free(
 				}
 			}
 		}
-		memory_free(
-		 internal_cache_value );
+		if( internal_cache_value->is_preallocated == 0 )
+		{
+			memory_free(
+			 internal_cache_value );
+		}
 	}
 	return( result );
 }
@@ -178,6 +181,7 @@ int libfcache_cache_value_clear(
 {
 	libfcache_internal_cache_value_t *internal_cache_value = NULL;
 	static char *function                                  = "libfcache_cache_value_free";
+	uint8_t is_preallocated                                = 0;
 
 	if( cache_value == NULL )
 	{
@@ -192,6 +196,10 @@ int libfcache_cache_value_clear(
 	}
 	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
 
+	/* The cache value remains part of its block of preallocated cache values
+	 */
+	is_preallocated = internal_cache_value->is_preallocated;
+
 	if( memory_set(
 	     internal_cache_value,
 	     0,
@@ -206,8 +214,9 @@ int libfcache_cache_value_clear(
 
 		return( -1 );
 	}
-	internal_cache_value->file_index = -1;
-	internal_cache_value->offset     = (off64_t) -1;
+	internal_cache_value->file_index      = -1;
+	internal_cache_value->offset          = (off64_t) -1;
+	internal_cache_value->is_preallocated = is_preallocated;
 
 	return( 1 );
 }
@@ -500,3 +509,271 @@ int libfcache_cache_value_set_value(
 	return( 1 );
 }
 
+/* Retrieves the cache value size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_value_get_value_size(
+     libfcache_cache_value_t *cache_value,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_value_get_value_size";
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	*value_size = internal_cache_value->value_size;
+
+	return( 1 );
+}
+
+/* Sets the cache value size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_value_set_value_size(
+     libfcache_cache_value_t *cache_value,
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_value_set_value_size";
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+	internal_cache_value->value_size = value_size;
+
+	return( 1 );
+}
+
+/* Retrieves the cache value expiry timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_value_get_expiry_timestamp(
+     libfcache_cache_value_t *cache_value,
+     int64_t *expiry_timestamp,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_value_get_expiry_timestamp";
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+	if( expiry_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expiry timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	*expiry_timestamp = internal_cache_value->expiry_timestamp;
+
+	return( 1 );
+}
+
+/* Sets the cache value expiry timestamp
+ * An expiry timestamp of 0 represents a value that does not expire
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_value_set_expiry_timestamp(
+     libfcache_cache_value_t *cache_value,
+     int64_t expiry_timestamp,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_value_set_expiry_timestamp";
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+	internal_cache_value->expiry_timestamp = expiry_timestamp;
+
+	return( 1 );
+}
+
+/* Retrieves the pin count
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_value_get_pin_count(
+     libfcache_cache_value_t *cache_value,
+     int *pin_count,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_value_get_pin_count";
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+	if( pin_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pin count.",
+		 function );
+
+		return( -1 );
+	}
+	*pin_count = internal_cache_value->pin_count;
+
+	return( 1 );
+}
+
+/* Pins the cache value, a pinned cache value is not replaced or cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_value_pin(
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_value_pin";
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+	if( internal_cache_value->pin_count == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache value - pin count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value->pin_count += 1;
+
+	return( 1 );
+}
+
+/* Unpins the cache value
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_value_unpin(
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_value_unpin";
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value = (libfcache_internal_cache_value_t *) cache_value;
+
+	if( internal_cache_value->pin_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache value - pin count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value->pin_count -= 1;
+
+	return( 1 );
+}
+
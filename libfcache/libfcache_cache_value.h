@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libfcache_extern.h"
+#include "libfcache_libcdata.h"
 #include "libfcache_libcerror.h"
 #include "libfcache_types.h"
 
@@ -57,6 +58,23 @@ struct libfcache_internal_cache_value
 	 */
 	intptr_t *value;
 
+	/* The value size
+	 */
+	size_t value_size;
+
+	/* The expiry timestamp, contains 0 if the value does not expire
+	 */
+	int64_t expiry_timestamp;
+
+	/* The pin count, the number of times the value was acquired and not released
+	 */
+	int pin_count;
+
+	/* Value to indicate the cache value is part of a block of preallocated
+	 * cache values and is not freed individually
+	 */
+	uint8_t is_preallocated;
+
 	/* The value free function
 	 */
 	int (*value_free_function)(
@@ -124,6 +142,39 @@ int libfcache_cache_value_set_value(
      uint8_t flags,
      libcerror_error_t **error );
 
+int libfcache_cache_value_get_value_size(
+     libfcache_cache_value_t *cache_value,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+int libfcache_cache_value_set_value_size(
+     libfcache_cache_value_t *cache_value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+int libfcache_cache_value_get_expiry_timestamp(
+     libfcache_cache_value_t *cache_value,
+     int64_t *expiry_timestamp,
+     libcerror_error_t **error );
+
+int libfcache_cache_value_set_expiry_timestamp(
+     libfcache_cache_value_t *cache_value,
+     int64_t expiry_timestamp,
+     libcerror_error_t **error );
+
+int libfcache_cache_value_get_pin_count(
+     libfcache_cache_value_t *cache_value,
+     int *pin_count,
+     libcerror_error_t **error );
+
+int libfcache_cache_value_pin(
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error );
+
+int libfcache_cache_value_unpin(
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,519 @@
+/*
+ * CLOCK (second chance) replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_clock.h"
+#include "libfcache_libcerror.h"
+
+/* Creates a clock
+ * Make sure the value cache_clock is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_initialize(
+     libfcache_clock_t **cache_clock,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_clock_t *safe_cache_clock = NULL;
+	static char *function               = "libfcache_clock_initialize";
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_clock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid clock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_cache_clock = memory_allocate_structure(
+	                    libfcache_clock_t );
+
+	if( safe_cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create clock.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_cache_clock,
+	     0,
+	     sizeof( libfcache_clock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear clock.",
+		 function );
+
+		memory_free(
+		 safe_cache_clock );
+
+		return( -1 );
+	}
+	safe_cache_clock->reference_bits = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * number_of_slots );
+
+	if( safe_cache_clock->reference_bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reference bits.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_cache_clock->reference_bits,
+	     0,
+	     sizeof( uint8_t ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear reference bits.",
+		 function );
+
+		goto on_error;
+	}
+	safe_cache_clock->number_of_slots = number_of_slots;
+
+	*cache_clock = safe_cache_clock;
+
+	return( 1 );
+
+on_error:
+	if( safe_cache_clock != NULL )
+	{
+		if( safe_cache_clock->reference_bits != NULL )
+		{
+			memory_free(
+			 safe_cache_clock->reference_bits );
+		}
+		memory_free(
+		 safe_cache_clock );
+	}
+	return( -1 );
+}
+
+/* Frees a clock
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_free(
+     libfcache_clock_t **cache_clock,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_clock_free";
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_clock != NULL )
+	{
+		if( ( *cache_clock )->reference_bits != NULL )
+		{
+			memory_free(
+			 ( *cache_clock )->reference_bits );
+		}
+		memory_free(
+		 *cache_clock );
+
+		*cache_clock = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the clock
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_clear(
+     libfcache_clock_t *cache_clock,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_clock_clear";
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     cache_clock->reference_bits,
+	     0,
+	     sizeof( uint8_t ) * cache_clock->number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear reference bits.",
+		 function );
+
+		return( -1 );
+	}
+	cache_clock->hand = 0;
+
+	return( 1 );
+}
+
+/* Resizes the clock
+ * The reference bits of the slots that remain are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_resize(
+     libfcache_clock_t *cache_clock,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_clock_resize";
+	void *reallocation    = NULL;
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                cache_clock->reference_bits,
+	                sizeof( uint8_t ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize reference bits.",
+		 function );
+
+		return( -1 );
+	}
+	cache_clock->reference_bits = (uint8_t *) reallocation;
+
+	if( number_of_slots > cache_clock->number_of_slots )
+	{
+		if( memory_set(
+		     &( cache_clock->reference_bits[ cache_clock->number_of_slots ] ),
+		     0,
+		     sizeof( uint8_t ) * ( number_of_slots - cache_clock->number_of_slots ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear reference bits.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( cache_clock->hand >= number_of_slots )
+	{
+		cache_clock->hand = 0;
+	}
+	cache_clock->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Inserts a slot
+ * A newly inserted slot is not referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_insert_slot(
+     libfcache_clock_t *cache_clock,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_clock_insert_slot";
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= cache_clock->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_clock->reference_bits[ slot ] = 0;
+
+	return( 1 );
+}
+
+/* Marks a slot as referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_reference_slot(
+     libfcache_clock_t *cache_clock,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_clock_reference_slot";
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= cache_clock->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only write the reference bit when it changes to keep hits read-only in the common case
+	 */
+	if( cache_clock->reference_bits[ slot ] == 0 )
+	{
+		cache_clock->reference_bits[ slot ] = 1;
+	}
+	return( 1 );
+}
+
+/* Removes a slot
+ * A removed slot is the first candidate to be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_remove_slot(
+     libfcache_clock_t *cache_clock,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_clock_remove_slot";
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= cache_clock->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_clock->reference_bits[ slot ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the slot to reuse
+ * Sweeps the hand over the slots and clears the reference bits of the slots it passes
+ * until it finds a slot that is not referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_clock_get_victim_slot(
+     libfcache_clock_t *cache_clock,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_clock_get_victim_slot";
+	int hand              = 0;
+
+	if( cache_clock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_clock->number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid clock - missing slots.",
+		 function );
+
+		return( -1 );
+	}
+	hand = cache_clock->hand;
+
+	/* The sweep ends within 2 revolutions since the first revolution clears all reference bits
+	 */
+	while( cache_clock->reference_bits[ hand ] != 0 )
+	{
+		cache_clock->reference_bits[ hand ] = 0;
+
+		hand++;
+
+		if( hand >= cache_clock->number_of_slots )
+		{
+			hand = 0;
+		}
+	}
+	*slot = hand;
+
+	hand++;
+
+	if( hand >= cache_clock->number_of_slots )
+	{
+		hand = 0;
+	}
+	cache_clock->hand = hand;
+
+	return( 1 );
+}
+
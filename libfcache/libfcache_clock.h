@@ -0,0 +1,94 @@
+/*
+ * CLOCK (second chance) replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_CLOCK_H )
+#define _LIBFCACHE_CLOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_clock libfcache_clock_t;
+
+struct libfcache_clock
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The hand, the slot where the next sweep starts
+	 */
+	int hand;
+
+	/* The reference bits, one per slot
+	 */
+	uint8_t *reference_bits;
+};
+
+int libfcache_clock_initialize(
+     libfcache_clock_t **cache_clock,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_clock_free(
+     libfcache_clock_t **cache_clock,
+     libcerror_error_t **error );
+
+int libfcache_clock_clear(
+     libfcache_clock_t *cache_clock,
+     libcerror_error_t **error );
+
+int libfcache_clock_resize(
+     libfcache_clock_t *cache_clock,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_clock_insert_slot(
+     libfcache_clock_t *cache_clock,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_clock_reference_slot(
+     libfcache_clock_t *cache_clock,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_clock_remove_slot(
+     libfcache_clock_t *cache_clock,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_clock_get_victim_slot(
+     libfcache_clock_t *cache_clock,
+     int *slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_CLOCK_H ) */
+
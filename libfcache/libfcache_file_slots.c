@@ -0,0 +1,987 @@
+/*
+ * The file slots functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_file_slots.h"
+#include "libfcache_libcerror.h"
+
+/* Searches the files for a specific file index
+ * file_position is set to the position of the file or the position
+ * where the file is inserted if the file index was not found
+ * Returns 1 if found or 0 if not
+ */
+static int libfcache_file_slots_find_file(
+            libfcache_file_slots_t *file_slots,
+            int file_index,
+            int *file_position )
+{
+	int first_position  = 0;
+	int last_position   = 0;
+	int middle_position = 0;
+
+	last_position = file_slots->number_of_files;
+
+	while( first_position < last_position )
+	{
+		middle_position = first_position + ( ( last_position - first_position ) / 2 );
+
+		if( file_slots->files[ middle_position ].file_index < file_index )
+		{
+			first_position = middle_position + 1;
+		}
+		else
+		{
+			last_position = middle_position;
+		}
+	}
+	*file_position = first_position;
+
+	if( ( first_position < file_slots->number_of_files )
+	 && ( file_slots->files[ first_position ].file_index == file_index ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines the priority of a slot in the tree of its file index
+ * The priority is derived from the slot number by a multiplicative hash
+ * which is a permutation hence no two slots have the same priority
+ */
+#define libfcache_file_slots_get_priority( slot ) \
+	( (uint32_t) ( slot ) * (uint32_t) 0x9e3779b1UL )
+
+/* Determines if the slot with offset_a orders before the slot with offset_b
+ * Slots with the same offset are ordered by slot number
+ */
+#define libfcache_file_slots_is_before( offset_a, slot_a, offset_b, slot_b ) \
+	( ( ( offset_a ) < ( offset_b ) ) || ( ( ( offset_a ) == ( offset_b ) ) && ( ( slot_a ) < ( slot_b ) ) ) )
+
+/* Replaces the child slot of a parent slot
+ * If the parent slot is -1 the root slot of the file is replaced
+ */
+static void libfcache_file_slots_replace_child(
+             libfcache_file_slots_t *file_slots,
+             libfcache_file_slots_file_t *file,
+             int parent_slot,
+             int child_slot,
+             int replacement_slot )
+{
+	if( parent_slot == -1 )
+	{
+		file->root_slot = replacement_slot;
+	}
+	else if( file_slots->entries[ parent_slot ].left_slot == child_slot )
+	{
+		file_slots->entries[ parent_slot ].left_slot = replacement_slot;
+	}
+	else
+	{
+		file_slots->entries[ parent_slot ].right_slot = replacement_slot;
+	}
+	if( replacement_slot != -1 )
+	{
+		file_slots->entries[ replacement_slot ].parent_slot = parent_slot;
+	}
+}
+
+/* Rotates a slot above its parent slot
+ */
+static void libfcache_file_slots_rotate_up(
+             libfcache_file_slots_t *file_slots,
+             libfcache_file_slots_file_t *file,
+             int slot )
+{
+	libfcache_file_slots_entry_t *entry        = NULL;
+	libfcache_file_slots_entry_t *parent_entry = NULL;
+	int parent_slot                            = 0;
+
+	entry        = &( file_slots->entries[ slot ] );
+	parent_slot  = entry->parent_slot;
+	parent_entry = &( file_slots->entries[ parent_slot ] );
+
+	libfcache_file_slots_replace_child(
+	 file_slots,
+	 file,
+	 parent_entry->parent_slot,
+	 parent_slot,
+	 slot );
+
+	if( parent_entry->left_slot == slot )
+	{
+		parent_entry->left_slot = entry->right_slot;
+
+		if( entry->right_slot != -1 )
+		{
+			file_slots->entries[ entry->right_slot ].parent_slot = parent_slot;
+		}
+		entry->right_slot = parent_slot;
+	}
+	else
+	{
+		parent_entry->right_slot = entry->left_slot;
+
+		if( entry->left_slot != -1 )
+		{
+			file_slots->entries[ entry->left_slot ].parent_slot = parent_slot;
+		}
+		entry->left_slot = parent_slot;
+	}
+	parent_entry->parent_slot = slot;
+}
+
+/* Retrieves the slot with the smallest offset in a (sub) tree
+ */
+static int libfcache_file_slots_get_leftmost_slot(
+            libfcache_file_slots_t *file_slots,
+            int slot )
+{
+	while( file_slots->entries[ slot ].left_slot != -1 )
+	{
+		slot = file_slots->entries[ slot ].left_slot;
+	}
+	return( slot );
+}
+
+/* Unlinks a slot from the tree of its file index
+ * The file is removed if it no longer contains slots
+ */
+static void libfcache_file_slots_unlink_slot(
+             libfcache_file_slots_t *file_slots,
+             int slot )
+{
+	libfcache_file_slots_entry_t *entry = NULL;
+	libfcache_file_slots_file_t *file   = NULL;
+	int child_slot                      = 0;
+	int file_position                   = 0;
+
+	entry = &( file_slots->entries[ slot ] );
+
+	if( entry->parent_slot == LIBFCACHE_FILE_SLOTS_SLOT_NOT_SET )
+	{
+		return;
+	}
+	if( libfcache_file_slots_find_file(
+	     file_slots,
+	     entry->file_index,
+	     &file_position ) == 1 )
+	{
+		file = &( file_slots->files[ file_position ] );
+
+		/* Rotate the slot down, keeping the child with the highest priority
+		 * on top, until it has at most one child
+		 */
+		while( ( entry->left_slot != -1 )
+		    && ( entry->right_slot != -1 ) )
+		{
+			if( libfcache_file_slots_get_priority( entry->left_slot ) > libfcache_file_slots_get_priority( entry->right_slot ) )
+			{
+				child_slot = entry->left_slot;
+			}
+			else
+			{
+				child_slot = entry->right_slot;
+			}
+			libfcache_file_slots_rotate_up(
+			 file_slots,
+			 file,
+			 child_slot );
+		}
+		if( entry->left_slot != -1 )
+		{
+			child_slot = entry->left_slot;
+		}
+		else
+		{
+			child_slot = entry->right_slot;
+		}
+		libfcache_file_slots_replace_child(
+		 file_slots,
+		 file,
+		 entry->parent_slot,
+		 slot,
+		 child_slot );
+
+		file->number_of_slots -= 1;
+
+		if( file->number_of_slots == 0 )
+		{
+			file_slots->number_of_files -= 1;
+
+			while( file_position < file_slots->number_of_files )
+			{
+				file_slots->files[ file_position ] = file_slots->files[ file_position + 1 ];
+
+				file_position++;
+			}
+		}
+	}
+	entry->parent_slot = LIBFCACHE_FILE_SLOTS_SLOT_NOT_SET;
+	entry->left_slot   = -1;
+	entry->right_slot  = -1;
+}
+
+/* Resets the entries of the slots from a specific slot onwards
+ */
+static void libfcache_file_slots_reset_entries(
+             libfcache_file_slots_t *file_slots,
+             int first_slot )
+{
+	int slot = 0;
+
+	for( slot = first_slot;
+	     slot < file_slots->number_of_slots;
+	     slot++ )
+	{
+		file_slots->entries[ slot ].file_index  = 0;
+		file_slots->entries[ slot ].offset      = 0;
+		file_slots->entries[ slot ].parent_slot = LIBFCACHE_FILE_SLOTS_SLOT_NOT_SET;
+		file_slots->entries[ slot ].left_slot   = -1;
+		file_slots->entries[ slot ].right_slot  = -1;
+	}
+}
+
+/* Creates file slots
+ * Make sure the value file_slots is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_file_slots_initialize(
+     libfcache_file_slots_t **file_slots,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_file_slots_t *safe_file_slots = NULL;
+	static char *function                   = "libfcache_file_slots_initialize";
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_slots != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file slots value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfcache_file_slots_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_file_slots = memory_allocate_structure(
+	                   libfcache_file_slots_t );
+
+	if( safe_file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_file_slots,
+	     0,
+	     sizeof( libfcache_file_slots_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file slots.",
+		 function );
+
+		memory_free(
+		 safe_file_slots );
+
+		return( -1 );
+	}
+	safe_file_slots->entries = (libfcache_file_slots_entry_t *) memory_allocate(
+	                                                             sizeof( libfcache_file_slots_entry_t ) * number_of_slots );
+
+	if( safe_file_slots->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	safe_file_slots->number_of_slots = number_of_slots;
+
+	libfcache_file_slots_reset_entries(
+	 safe_file_slots,
+	 0 );
+
+	*file_slots = safe_file_slots;
+
+	return( 1 );
+
+on_error:
+	if( safe_file_slots != NULL )
+	{
+		memory_free(
+		 safe_file_slots );
+	}
+	return( -1 );
+}
+
+/* Frees file slots
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_file_slots_free(
+     libfcache_file_slots_t **file_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_free";
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_slots != NULL )
+	{
+		if( ( *file_slots )->files != NULL )
+		{
+			memory_free(
+			 ( *file_slots )->files );
+		}
+		if( ( *file_slots )->entries != NULL )
+		{
+			memory_free(
+			 ( *file_slots )->entries );
+		}
+		memory_free(
+		 *file_slots );
+
+		*file_slots = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the file slots
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_file_slots_clear(
+     libfcache_file_slots_t *file_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_clear";
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_file_slots_reset_entries(
+	 file_slots,
+	 0 );
+
+	file_slots->number_of_files = 0;
+
+	return( 1 );
+}
+
+/* Resizes the file slots
+ * The slots that remain retain their file index
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_file_slots_resize(
+     libfcache_file_slots_t *file_slots,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_resize";
+	void *reallocation    = NULL;
+	int number_of_entries = 0;
+	int slot              = 0;
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfcache_file_slots_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Unlink the slots that are removed by the resize
+	 */
+	for( slot = number_of_slots;
+	     slot < file_slots->number_of_slots;
+	     slot++ )
+	{
+		libfcache_file_slots_unlink_slot(
+		 file_slots,
+		 slot );
+	}
+	reallocation = memory_reallocate(
+	                file_slots->entries,
+	                sizeof( libfcache_file_slots_entry_t ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize entries.",
+		 function );
+
+		return( -1 );
+	}
+	file_slots->entries = (libfcache_file_slots_entry_t *) reallocation;
+
+	number_of_entries = file_slots->number_of_slots;
+
+	file_slots->number_of_slots = number_of_slots;
+
+	if( number_of_entries < number_of_slots )
+	{
+		libfcache_file_slots_reset_entries(
+		 file_slots,
+		 number_of_entries );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of slots of a specific file index
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_file_slots_get_number_of_slots(
+     libfcache_file_slots_t *file_slots,
+     int file_index,
+     int *number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_get_number_of_slots";
+	int file_position     = 0;
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of slots.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_slots = 0;
+
+	if( libfcache_file_slots_find_file(
+	     file_slots,
+	     file_index,
+	     &file_position ) == 1 )
+	{
+		*number_of_slots = file_slots->files[ file_position ].number_of_slots;
+	}
+	return( 1 );
+}
+
+/* Retrieves the first slot of a specific file index, which is the slot with the smallest offset
+ * Returns 1 if successful, 0 if the file index has no slots or -1 on error
+ */
+int libfcache_file_slots_get_first_slot(
+     libfcache_file_slots_t *file_slots,
+     int file_index,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_get_first_slot";
+	int file_position     = 0;
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_file_slots_find_file(
+	     file_slots,
+	     file_index,
+	     &file_position ) != 1 )
+	{
+		return( 0 );
+	}
+	*slot = libfcache_file_slots_get_leftmost_slot(
+	         file_slots,
+	         file_slots->files[ file_position ].root_slot );
+
+	return( 1 );
+}
+
+/* Retrieves the first slot of a specific file index with an offset equal to or larger than the offset
+ * Returns 1 if successful, 0 if the file index has no such slot or -1 on error
+ */
+int libfcache_file_slots_get_first_slot_from_offset(
+     libfcache_file_slots_t *file_slots,
+     int file_index,
+     off64_t offset,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_get_first_slot_from_offset";
+	int file_position     = 0;
+	int found_slot        = -1;
+	int search_slot       = 0;
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_file_slots_find_file(
+	     file_slots,
+	     file_index,
+	     &file_position ) != 1 )
+	{
+		return( 0 );
+	}
+	search_slot = file_slots->files[ file_position ].root_slot;
+
+	while( search_slot != -1 )
+	{
+		if( file_slots->entries[ search_slot ].offset >= offset )
+		{
+			found_slot  = search_slot;
+			search_slot = file_slots->entries[ search_slot ].left_slot;
+		}
+		else
+		{
+			search_slot = file_slots->entries[ search_slot ].right_slot;
+		}
+	}
+	if( found_slot == -1 )
+	{
+		return( 0 );
+	}
+	*slot = found_slot;
+
+	return( 1 );
+}
+
+/* Retrieves the next slot of the same file index, which is the slot with the next larger offset
+ * Returns 1 if successful, 0 if there is no next slot or -1 on error
+ */
+int libfcache_file_slots_get_next_slot(
+     libfcache_file_slots_t *file_slots,
+     int slot,
+     int *next_slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_get_next_slot";
+	int parent_slot       = 0;
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= file_slots->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_slots->entries[ slot ].parent_slot == LIBFCACHE_FILE_SLOTS_SLOT_NOT_SET )
+	{
+		return( 0 );
+	}
+	if( file_slots->entries[ slot ].right_slot != -1 )
+	{
+		*next_slot = libfcache_file_slots_get_leftmost_slot(
+		              file_slots,
+		              file_slots->entries[ slot ].right_slot );
+
+		return( 1 );
+	}
+	/* Ascend until the slot is in the left sub tree of its parent
+	 */
+	parent_slot = file_slots->entries[ slot ].parent_slot;
+
+	while( ( parent_slot != -1 )
+	    && ( file_slots->entries[ parent_slot ].right_slot == slot ) )
+	{
+		slot        = parent_slot;
+		parent_slot = file_slots->entries[ slot ].parent_slot;
+	}
+	if( parent_slot == -1 )
+	{
+		return( 0 );
+	}
+	*next_slot = parent_slot;
+
+	return( 1 );
+}
+
+/* Inserts a slot with a specific file index and offset
+ * The slot is removed from the slots of the file index it was stored with
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_file_slots_insert_slot(
+     libfcache_file_slots_t *file_slots,
+     int slot,
+     int file_index,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libfcache_file_slots_entry_t *entry = NULL;
+	libfcache_file_slots_file_t *file   = NULL;
+	static char *function               = "libfcache_file_slots_insert_slot";
+	void *reallocation                  = NULL;
+	int file_position                   = 0;
+	int maximum_number_of_files         = 0;
+	int parent_slot                     = 0;
+	int position                        = 0;
+	int search_slot                     = 0;
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= file_slots->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_file_slots_unlink_slot(
+	 file_slots,
+	 slot );
+
+	if( libfcache_file_slots_find_file(
+	     file_slots,
+	     file_index,
+	     &file_position ) != 1 )
+	{
+		if( file_slots->number_of_files >= file_slots->maximum_number_of_files )
+		{
+			/* Every file has at least one slot hence the number of files
+			 * never exceeds the number of slots
+			 */
+			maximum_number_of_files = file_slots->maximum_number_of_files * 2;
+
+			if( maximum_number_of_files < LIBFCACHE_FILE_SLOTS_MINIMUM_NUMBER_OF_FILES )
+			{
+				maximum_number_of_files = LIBFCACHE_FILE_SLOTS_MINIMUM_NUMBER_OF_FILES;
+			}
+			if( maximum_number_of_files > file_slots->number_of_slots )
+			{
+				maximum_number_of_files = file_slots->number_of_slots;
+			}
+			reallocation = memory_reallocate(
+			                file_slots->files,
+			                sizeof( libfcache_file_slots_file_t ) * maximum_number_of_files );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize files.",
+				 function );
+
+				return( -1 );
+			}
+			file_slots->files                   = (libfcache_file_slots_file_t *) reallocation;
+			file_slots->maximum_number_of_files = maximum_number_of_files;
+		}
+		for( position = file_slots->number_of_files;
+		     position > file_position;
+		     position-- )
+		{
+			file_slots->files[ position ] = file_slots->files[ position - 1 ];
+		}
+		file_slots->number_of_files += 1;
+
+		file = &( file_slots->files[ file_position ] );
+
+		file->file_index      = file_index;
+		file->root_slot       = -1;
+		file->number_of_slots = 0;
+	}
+	else
+	{
+		file = &( file_slots->files[ file_position ] );
+	}
+	entry = &( file_slots->entries[ slot ] );
+
+	entry->file_index = file_index;
+	entry->offset     = offset;
+	entry->left_slot  = -1;
+	entry->right_slot = -1;
+
+	/* Insert the slot as a leaf ordered by offset
+	 */
+	parent_slot = -1;
+	search_slot = file->root_slot;
+
+	while( search_slot != -1 )
+	{
+		parent_slot = search_slot;
+
+		if( libfcache_file_slots_is_before(
+		     offset,
+		     slot,
+		     file_slots->entries[ search_slot ].offset,
+		     search_slot ) )
+		{
+			search_slot = file_slots->entries[ search_slot ].left_slot;
+		}
+		else
+		{
+			search_slot = file_slots->entries[ search_slot ].right_slot;
+		}
+	}
+	entry->parent_slot = parent_slot;
+
+	if( parent_slot == -1 )
+	{
+		file->root_slot = slot;
+	}
+	else if( libfcache_file_slots_is_before(
+	          offset,
+	          slot,
+	          file_slots->entries[ parent_slot ].offset,
+	          parent_slot ) )
+	{
+		file_slots->entries[ parent_slot ].left_slot = slot;
+	}
+	else
+	{
+		file_slots->entries[ parent_slot ].right_slot = slot;
+	}
+	/* Restore the heap order of the priorities, which keeps the tree balanced
+	 * with an expected depth that is logarithmic in the number of slots
+	 */
+	while( ( entry->parent_slot != -1 )
+	    && ( libfcache_file_slots_get_priority( slot ) > libfcache_file_slots_get_priority( entry->parent_slot ) ) )
+	{
+		libfcache_file_slots_rotate_up(
+		 file_slots,
+		 file,
+		 slot );
+	}
+	file->number_of_slots += 1;
+
+	return( 1 );
+}
+
+/* Removes a slot
+ * Removing a slot that is not stored in the file slots has no effect
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_file_slots_remove_slot(
+     libfcache_file_slots_t *file_slots,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_file_slots_remove_slot";
+
+	if( file_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= file_slots->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_file_slots_unlink_slot(
+	 file_slots,
+	 slot );
+
+	return( 1 );
+}
+
@@ -0,0 +1,163 @@
+/*
+ * The file slots functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_FILE_SLOTS_H )
+#define _LIBFCACHE_FILE_SLOTS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_file_slots_entry libfcache_file_slots_entry_t;
+
+struct libfcache_file_slots_entry
+{
+	/* The file index
+	 */
+	int file_index;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The parent slot in the tree of the file index
+	 * Contains -1 if the slot is the root slot or LIBFCACHE_FILE_SLOTS_SLOT_NOT_SET
+	 * if the slot is not stored in the file slots
+	 */
+	int parent_slot;
+
+	/* The left child slot, with a smaller offset, contains -1 if not set
+	 */
+	int left_slot;
+
+	/* The right child slot, with a larger offset, contains -1 if not set
+	 */
+	int right_slot;
+};
+
+typedef struct libfcache_file_slots_file libfcache_file_slots_file_t;
+
+struct libfcache_file_slots_file
+{
+	/* The file index
+	 */
+	int file_index;
+
+	/* The root slot of the tree of the file index
+	 */
+	int root_slot;
+
+	/* The number of slots of the file index
+	 */
+	int number_of_slots;
+};
+
+typedef struct libfcache_file_slots libfcache_file_slots_t;
+
+struct libfcache_file_slots
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The entries, one per slot
+	 */
+	libfcache_file_slots_entry_t *entries;
+
+	/* The files, one per file index that has slots, sorted by file index
+	 */
+	libfcache_file_slots_file_t *files;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of files that fit in the allocated files
+	 */
+	int maximum_number_of_files;
+};
+
+int libfcache_file_slots_initialize(
+     libfcache_file_slots_t **file_slots,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_free(
+     libfcache_file_slots_t **file_slots,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_clear(
+     libfcache_file_slots_t *file_slots,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_resize(
+     libfcache_file_slots_t *file_slots,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_get_number_of_slots(
+     libfcache_file_slots_t *file_slots,
+     int file_index,
+     int *number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_get_first_slot(
+     libfcache_file_slots_t *file_slots,
+     int file_index,
+     int *slot,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_get_first_slot_from_offset(
+     libfcache_file_slots_t *file_slots,
+     int file_index,
+     off64_t offset,
+     int *slot,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_get_next_slot(
+     libfcache_file_slots_t *file_slots,
+     int slot,
+     int *next_slot,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_insert_slot(
+     libfcache_file_slots_t *file_slots,
+     int slot,
+     int file_index,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libfcache_file_slots_remove_slot(
+     libfcache_file_slots_t *file_slots,
+     int slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_FILE_SLOTS_H ) */
+
@@ -0,0 +1,1105 @@
+/*
+ * Flat (open-addressing) table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBFCACHE_FLAT_TABLE_HAVE_SSE2	1
+#include <emmintrin.h>
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#define LIBFCACHE_FLAT_TABLE_HAVE_NEON	1
+#include <arm_neon.h>
+#endif
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+#include "libfcache_definitions.h"
+#include "libfcache_flat_table.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+
+#if defined( LIBFCACHE_FLAT_TABLE_HAVE_NEON )
+
+/* The bit values used to convert a NEON comparison result into a bit mask
+ */
+static const uint8_t libfcache_flat_table_neon_bit_values[ 16 ] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+
+#endif /* defined( LIBFCACHE_FLAT_TABLE_HAVE_NEON ) */
+
+/* Retrieves the index of the least significant bit set in a non-zero mask
+ * Returns the bit index
+ */
+static int libfcache_flat_table_get_first_bit_index(
+            uint32_t mask )
+{
+#if defined( __GNUC__ )
+	return( __builtin_ctz( mask ) );
+
+#elif defined( _MSC_VER )
+	unsigned long bit_index = 0;
+
+	_BitScanForward(
+	 &bit_index,
+	 (unsigned long) mask );
+
+	return( (int) bit_index );
+#else
+	int bit_index = 0;
+
+	while( ( mask & 0x00000001UL ) == 0 )
+	{
+		mask >>= 1;
+
+		bit_index++;
+	}
+	return( bit_index );
+#endif
+}
+
+/* Retrieves the number of leading zero bits of a group mask
+ * Returns the number of leading zero bits
+ */
+static int libfcache_flat_table_get_number_of_leading_zero_bits(
+            uint32_t mask )
+{
+	int number_of_bits = LIBFCACHE_FLAT_TABLE_GROUP_SIZE;
+
+	while( mask != 0 )
+	{
+		mask >>= 1;
+
+		number_of_bits--;
+	}
+	return( number_of_bits );
+}
+
+/* Determines the number of positions and allocates the control bytes, entries and positions of the flat table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_allocate(
+     int number_of_slots,
+     uint32_t *number_of_positions,
+     uint8_t **control_bytes,
+     libfcache_flat_table_entry_t **entries,
+     int32_t **positions,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfcache_flat_table_allocate";
+	size_t control_bytes_size         = 0;
+	size_t entries_size               = 0;
+	size_t positions_size             = 0;
+	uint64_t minimum_growth           = 0;
+	uint64_t safe_number_of_positions = LIBFCACHE_FLAT_TABLE_GROUP_SIZE;
+	int slot                          = 0;
+
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a power of 2 number of positions with a maximum load factor of 7/8
+	 * and leave room for at least 1/8 of the slots to become deleted
+	 * before the table needs to be rebuilt
+	 */
+	minimum_growth = (uint64_t) number_of_slots + ( (uint64_t) number_of_slots / 8 ) + 1;
+
+	while( ( ( safe_number_of_positions / 8 ) * 7 ) < minimum_growth )
+	{
+		safe_number_of_positions <<= 1;
+	}
+	if( ( safe_number_of_positions > (uint64_t) INT32_MAX )
+	 || ( safe_number_of_positions > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfcache_flat_table_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	control_bytes_size = (size_t) safe_number_of_positions + ( LIBFCACHE_FLAT_TABLE_GROUP_SIZE - 1 );
+	entries_size       = sizeof( libfcache_flat_table_entry_t ) * (size_t) safe_number_of_positions;
+	positions_size     = sizeof( int32_t ) * number_of_slots;
+
+	*control_bytes = (uint8_t *) memory_allocate(
+	                              control_bytes_size );
+
+	if( *control_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create control bytes.",
+		 function );
+
+		goto on_error;
+	}
+	*entries = (libfcache_flat_table_entry_t *) memory_allocate(
+	                                             entries_size );
+
+	if( *entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	*positions = (int32_t *) memory_allocate(
+	                          positions_size );
+
+	if( *positions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create positions.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *control_bytes,
+	     LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_EMPTY,
+	     control_bytes_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear control bytes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot = 0;
+	     slot < number_of_slots;
+	     slot++ )
+	{
+		( *positions )[ slot ] = -1;
+	}
+	*number_of_positions = (uint32_t) safe_number_of_positions;
+
+	return( 1 );
+
+on_error:
+	if( *positions != NULL )
+	{
+		memory_free(
+		 *positions );
+
+		*positions = NULL;
+	}
+	if( *entries != NULL )
+	{
+		memory_free(
+		 *entries );
+
+		*entries = NULL;
+	}
+	if( *control_bytes != NULL )
+	{
+		memory_free(
+		 *control_bytes );
+
+		*control_bytes = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a flat table
+ * Make sure the value flat_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_initialize(
+     libfcache_flat_table_t **flat_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_flat_table_t *safe_flat_table = NULL;
+	static char *function                   = "libfcache_flat_table_initialize";
+
+	if( flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flat table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *flat_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid flat table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	safe_flat_table = memory_allocate_structure(
+	                   libfcache_flat_table_t );
+
+	if( safe_flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create flat table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_flat_table,
+	     0,
+	     sizeof( libfcache_flat_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear flat table.",
+		 function );
+
+		memory_free(
+		 safe_flat_table );
+
+		return( -1 );
+	}
+	if( libfcache_flat_table_allocate(
+	     number_of_slots,
+	     &( safe_flat_table->number_of_positions ),
+	     &( safe_flat_table->control_bytes ),
+	     &( safe_flat_table->entries ),
+	     &( safe_flat_table->positions ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate control bytes, entries and positions.",
+		 function );
+
+		goto on_error;
+	}
+	safe_flat_table->number_of_slots = number_of_slots;
+	safe_flat_table->growth_left     = ( safe_flat_table->number_of_positions / 8 ) * 7;
+
+	*flat_table = safe_flat_table;
+
+	return( 1 );
+
+on_error:
+	if( safe_flat_table != NULL )
+	{
+		memory_free(
+		 safe_flat_table );
+	}
+	return( -1 );
+}
+
+/* Frees a flat table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_free(
+     libfcache_flat_table_t **flat_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_flat_table_free";
+
+	if( flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flat table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *flat_table != NULL )
+	{
+		if( ( *flat_table )->positions != NULL )
+		{
+			memory_free(
+			 ( *flat_table )->positions );
+		}
+		if( ( *flat_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *flat_table )->entries );
+		}
+		if( ( *flat_table )->control_bytes != NULL )
+		{
+			memory_free(
+			 ( *flat_table )->control_bytes );
+		}
+		memory_free(
+		 *flat_table );
+
+		*flat_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the flat table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_clear(
+     libfcache_flat_table_t *flat_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_flat_table_clear";
+	int slot              = 0;
+
+	if( flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flat table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     flat_table->control_bytes,
+	     LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_EMPTY,
+	     (size_t) flat_table->number_of_positions + ( LIBFCACHE_FLAT_TABLE_GROUP_SIZE - 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear control bytes.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot = 0;
+	     slot < flat_table->number_of_slots;
+	     slot++ )
+	{
+		flat_table->positions[ slot ] = -1;
+	}
+	flat_table->growth_left = ( flat_table->number_of_positions / 8 ) * 7;
+
+	return( 1 );
+}
+
+/* Sets the control byte of a specific position
+ * The control bytes of the first group size - 1 positions are also copied after the last position
+ */
+static void libfcache_flat_table_set_control_byte(
+             libfcache_flat_table_t *flat_table,
+             uint32_t position,
+             uint8_t control_byte )
+{
+	flat_table->control_bytes[ position ] = control_byte;
+
+	if( position < ( LIBFCACHE_FLAT_TABLE_GROUP_SIZE - 1 ) )
+	{
+		flat_table->control_bytes[ flat_table->number_of_positions + position ] = control_byte;
+	}
+}
+
+/* Stores a slot in the first free position of the probe sequence of its identifier
+ * Returns 1 if successful or -1 on error
+ */
+static int libfcache_flat_table_store_slot(
+            libfcache_flat_table_t *flat_table,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error )
+{
+	libfcache_flat_table_entry_t *entry = NULL;
+	static char *function               = "libfcache_flat_table_store_slot";
+	uint32_t free_mask                  = 0;
+	uint32_t hash                       = 0;
+	uint32_t number_of_probes           = 0;
+	uint32_t position                   = 0;
+	uint32_t position_mask              = 0;
+
+	hash = libfcache_hash_table_calculate_hash(
+	        file_index,
+	        offset,
+	        timestamp );
+
+	position_mask = flat_table->number_of_positions - 1;
+	position      = hash & position_mask;
+
+	while( number_of_probes < ( flat_table->number_of_positions / LIBFCACHE_FLAT_TABLE_GROUP_SIZE ) )
+	{
+		free_mask = libfcache_flat_table_get_group_free_mask(
+		             &( flat_table->control_bytes[ position ] ) );
+
+		if( free_mask != 0 )
+		{
+			position = ( position + libfcache_flat_table_get_first_bit_index(
+			                         free_mask ) ) & position_mask;
+
+			if( flat_table->control_bytes[ position ] == LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_EMPTY )
+			{
+				flat_table->growth_left -= 1;
+			}
+			libfcache_flat_table_set_control_byte(
+			 flat_table,
+			 position,
+			 (uint8_t) ( hash >> 25 ) );
+
+			entry = &( flat_table->entries[ position ] );
+
+			entry->offset     = offset;
+			entry->timestamp  = timestamp;
+			entry->file_index = file_index;
+			entry->slot       = slot;
+
+			flat_table->positions[ slot ] = (int32_t) position;
+
+			return( 1 );
+		}
+		number_of_probes++;
+
+		position = ( position + ( number_of_probes * LIBFCACHE_FLAT_TABLE_GROUP_SIZE ) ) & position_mask;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing free position.",
+	 function );
+
+	return( -1 );
+}
+
+/* Rebuilds the flat table
+ * The identifiers of the slots that remain are retained and deleted positions are reclaimed
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_rebuild(
+     libfcache_flat_table_t *flat_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_flat_table_t rebuilt_table;
+
+	libfcache_flat_table_entry_t *entry = NULL;
+	static char *function               = "libfcache_flat_table_rebuild";
+	int number_of_retained_slots        = 0;
+	int slot                            = 0;
+
+	if( flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flat table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &rebuilt_table,
+	     0,
+	     sizeof( libfcache_flat_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear rebuilt table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_flat_table_allocate(
+	     number_of_slots,
+	     &( rebuilt_table.number_of_positions ),
+	     &( rebuilt_table.control_bytes ),
+	     &( rebuilt_table.entries ),
+	     &( rebuilt_table.positions ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to allocate control bytes, entries and positions.",
+		 function );
+
+		return( -1 );
+	}
+	rebuilt_table.number_of_slots = number_of_slots;
+	rebuilt_table.growth_left     = ( rebuilt_table.number_of_positions / 8 ) * 7;
+
+	number_of_retained_slots = flat_table->number_of_slots;
+
+	if( number_of_retained_slots > number_of_slots )
+	{
+		number_of_retained_slots = number_of_slots;
+	}
+	for( slot = 0;
+	     slot < number_of_retained_slots;
+	     slot++ )
+	{
+		if( flat_table->positions[ slot ] < 0 )
+		{
+			continue;
+		}
+		entry = &( flat_table->entries[ flat_table->positions[ slot ] ] );
+
+		if( libfcache_flat_table_store_slot(
+		     &rebuilt_table,
+		     slot,
+		     entry->file_index,
+		     entry->offset,
+		     entry->timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to store slot: %d.",
+			 function,
+			 slot );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 flat_table->positions );
+
+	memory_free(
+	 flat_table->entries );
+
+	memory_free(
+	 flat_table->control_bytes );
+
+	flat_table->number_of_slots     = rebuilt_table.number_of_slots;
+	flat_table->number_of_positions = rebuilt_table.number_of_positions;
+	flat_table->growth_left         = rebuilt_table.growth_left;
+	flat_table->control_bytes       = rebuilt_table.control_bytes;
+	flat_table->entries             = rebuilt_table.entries;
+	flat_table->positions           = rebuilt_table.positions;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 rebuilt_table.positions );
+
+	memory_free(
+	 rebuilt_table.entries );
+
+	memory_free(
+	 rebuilt_table.control_bytes );
+
+	return( -1 );
+}
+
+/* Resizes the flat table
+ * The identifiers of the slots that remain are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_resize(
+     libfcache_flat_table_t *flat_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_flat_table_resize";
+
+	if( libfcache_flat_table_rebuild(
+	     flat_table,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to rebuild flat table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a bit mask of the positions in a group that contain a specific control byte
+ * The group must contain LIBFCACHE_FLAT_TABLE_GROUP_SIZE control bytes
+ * Returns the bit mask
+ */
+uint32_t libfcache_flat_table_get_group_match_mask(
+          const uint8_t *group,
+          uint8_t control_byte )
+{
+#if defined( LIBFCACHE_FLAT_TABLE_HAVE_SSE2 )
+	__m128i compare = _mm_cmpeq_epi8(
+	                   _mm_loadu_si128(
+	                    (const __m128i *) group ),
+	                   _mm_set1_epi8(
+	                    (char) control_byte ) );
+
+	return( (uint32_t) _mm_movemask_epi8(
+	                    compare ) );
+
+#elif defined( LIBFCACHE_FLAT_TABLE_HAVE_NEON )
+	uint8x16_t bits = vandq_u8(
+	                   vceqq_u8(
+	                    vld1q_u8(
+	                     group ),
+	                    vdupq_n_u8(
+	                     control_byte ) ),
+	                   vld1q_u8(
+	                    libfcache_flat_table_neon_bit_values ) );
+
+	return( (uint32_t) vaddv_u8( vget_low_u8( bits ) )
+	     | ( (uint32_t) vaddv_u8( vget_high_u8( bits ) ) << 8 ) );
+#else
+	uint32_t mask  = 0;
+	int byte_index = 0;
+
+	for( byte_index = 0;
+	     byte_index < LIBFCACHE_FLAT_TABLE_GROUP_SIZE;
+	     byte_index++ )
+	{
+		if( group[ byte_index ] == control_byte )
+		{
+			mask |= (uint32_t) 1 << byte_index;
+		}
+	}
+	return( mask );
+#endif
+}
+
+/* Retrieves a bit mask of the positions in a group that are empty or deleted
+ * The group must contain LIBFCACHE_FLAT_TABLE_GROUP_SIZE control bytes
+ * Returns the bit mask
+ */
+uint32_t libfcache_flat_table_get_group_free_mask(
+          const uint8_t *group )
+{
+	/* Both the empty and deleted control byte have the most significant bit set
+	 */
+#if defined( LIBFCACHE_FLAT_TABLE_HAVE_SSE2 )
+	return( (uint32_t) _mm_movemask_epi8(
+	                    _mm_loadu_si128(
+	                     (const __m128i *) group ) ) );
+
+#elif defined( LIBFCACHE_FLAT_TABLE_HAVE_NEON )
+	uint8x16_t bits = vandq_u8(
+	                   vreinterpretq_u8_s8(
+	                    vshrq_n_s8(
+	                     vreinterpretq_s8_u8(
+	                      vld1q_u8(
+	                       group ) ),
+	                     7 ) ),
+	                   vld1q_u8(
+	                    libfcache_flat_table_neon_bit_values ) );
+
+	return( (uint32_t) vaddv_u8( vget_low_u8( bits ) )
+	     | ( (uint32_t) vaddv_u8( vget_high_u8( bits ) ) << 8 ) );
+#else
+	uint32_t mask  = 0;
+	int byte_index = 0;
+
+	for( byte_index = 0;
+	     byte_index < LIBFCACHE_FLAT_TABLE_GROUP_SIZE;
+	     byte_index++ )
+	{
+		if( ( group[ byte_index ] & 0x80 ) != 0 )
+		{
+			mask |= (uint32_t) 1 << byte_index;
+		}
+	}
+	return( mask );
+#endif
+}
+
+/* Retrieves the slot that matches the identifier
+ * Returns 1 if successful, 0 if no such slot or -1 on error
+ */
+int libfcache_flat_table_get_slot_by_identifier(
+     libfcache_flat_table_t *flat_table,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *slot,
+     libcerror_error_t **error )
+{
+	libfcache_flat_table_entry_t *entry = NULL;
+	const uint8_t *group                = NULL;
+	static char *function               = "libfcache_flat_table_get_slot_by_identifier";
+	uint32_t entry_position             = 0;
+	uint32_t hash                       = 0;
+	uint32_t match_mask                 = 0;
+	uint32_t number_of_probes           = 0;
+	uint32_t position                   = 0;
+	uint32_t position_mask              = 0;
+	uint8_t control_byte                = 0;
+
+	if( flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flat table.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfcache_hash_table_calculate_hash(
+	        file_index,
+	        offset,
+	        timestamp );
+
+	control_byte  = (uint8_t) ( hash >> 25 );
+	position_mask = flat_table->number_of_positions - 1;
+	position      = hash & position_mask;
+
+	while( number_of_probes < ( flat_table->number_of_positions / LIBFCACHE_FLAT_TABLE_GROUP_SIZE ) )
+	{
+		group = &( flat_table->control_bytes[ position ] );
+
+		match_mask = libfcache_flat_table_get_group_match_mask(
+		              group,
+		              control_byte );
+
+		while( match_mask != 0 )
+		{
+			entry_position = ( position + libfcache_flat_table_get_first_bit_index(
+			                               match_mask ) ) & position_mask;
+
+			entry = &( flat_table->entries[ entry_position ] );
+
+			if( ( entry->offset == offset )
+			 && ( entry->file_index == file_index )
+			 && ( entry->timestamp == timestamp ) )
+			{
+				*slot = entry->slot;
+
+				return( 1 );
+			}
+			match_mask &= match_mask - 1;
+		}
+		/* The probe sequence ends at the first group that contains an empty position
+		 */
+		if( libfcache_flat_table_get_group_match_mask(
+		     group,
+		     LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_EMPTY ) != 0 )
+		{
+			break;
+		}
+		number_of_probes++;
+
+		position = ( position + ( number_of_probes * LIBFCACHE_FLAT_TABLE_GROUP_SIZE ) ) & position_mask;
+	}
+	return( 0 );
+}
+
+/* Inserts a slot with a specific identifier
+ * If the slot is already stored it is removed first
+ * If another slot is stored with the same identifier it is replaced,
+ * so that the most recently stored identifier is found
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_insert_slot(
+     libfcache_flat_table_t *flat_table,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_flat_table_insert_slot";
+	int existing_slot     = 0;
+	int result            = 0;
+
+	if( flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flat table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= flat_table->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( flat_table->positions[ slot ] >= 0 )
+	{
+		if( libfcache_flat_table_remove_slot(
+		     flat_table,
+		     slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove slot: %d.",
+			 function,
+			 slot );
+
+			return( -1 );
+		}
+	}
+	result = libfcache_flat_table_get_slot_by_identifier(
+	          flat_table,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &existing_slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_flat_table_remove_slot(
+		     flat_table,
+		     existing_slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove slot: %d.",
+			 function,
+			 existing_slot );
+
+			return( -1 );
+		}
+	}
+	/* Reclaim the deleted positions when there are no more empty positions to fill
+	 */
+	if( flat_table->growth_left == 0 )
+	{
+		if( libfcache_flat_table_rebuild(
+		     flat_table,
+		     flat_table->number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rebuild flat table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfcache_flat_table_store_slot(
+	     flat_table,
+	     slot,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to store slot: %d.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a slot
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_flat_table_remove_slot(
+     libfcache_flat_table_t *flat_table,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfcache_flat_table_remove_slot";
+	uint32_t empty_after   = 0;
+	uint32_t empty_before  = 0;
+	uint32_t position      = 0;
+	uint32_t position_mask = 0;
+
+	if( flat_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flat table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= flat_table->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( flat_table->positions[ slot ] < 0 )
+	{
+		return( 1 );
+	}
+	position_mask = flat_table->number_of_positions - 1;
+	position      = (uint32_t) flat_table->positions[ slot ];
+
+	empty_after = libfcache_flat_table_get_group_match_mask(
+	               &( flat_table->control_bytes[ position ] ),
+	               LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_EMPTY );
+
+	empty_before = libfcache_flat_table_get_group_match_mask(
+	                &( flat_table->control_bytes[ ( position - LIBFCACHE_FLAT_TABLE_GROUP_SIZE ) & position_mask ] ),
+	                LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_EMPTY );
+
+	/* The position can be marked as empty if every group that contains it
+	 * also contains an empty position, since then no probe sequence has
+	 * continued past the position, otherwise it is marked as deleted
+	 */
+	if( ( empty_after != 0 )
+	 && ( empty_before != 0 )
+	 && ( ( libfcache_flat_table_get_first_bit_index(
+	         empty_after )
+	      + libfcache_flat_table_get_number_of_leading_zero_bits(
+	         empty_before ) ) < LIBFCACHE_FLAT_TABLE_GROUP_SIZE ) )
+	{
+		libfcache_flat_table_set_control_byte(
+		 flat_table,
+		 position,
+		 LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_EMPTY );
+
+		flat_table->growth_left += 1;
+	}
+	else
+	{
+		libfcache_flat_table_set_control_byte(
+		 flat_table,
+		 position,
+		 LIBFCACHE_FLAT_TABLE_CONTROL_BYTE_DELETED );
+	}
+	flat_table->positions[ slot ] = -1;
+
+	return( 1 );
+}
+
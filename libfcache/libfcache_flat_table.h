@@ -0,0 +1,149 @@
+/*
+ * Flat (open-addressing) table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_FLAT_TABLE_H )
+#define _LIBFCACHE_FLAT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_flat_table_entry libfcache_flat_table_entry_t;
+
+struct libfcache_flat_table_entry
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The timestamp
+	 */
+	int64_t timestamp;
+
+	/* The file index
+	 */
+	int file_index;
+
+	/* The slot
+	 */
+	int slot;
+};
+
+typedef struct libfcache_flat_table libfcache_flat_table_t;
+
+struct libfcache_flat_table
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The number of positions, a power of 2 of at least the group size
+	 */
+	uint32_t number_of_positions;
+
+	/* The number of positions that can be filled before the table needs to be rebuilt
+	 */
+	uint32_t growth_left;
+
+	/* The control bytes, one per position followed by a copy of the first
+	 * group size - 1 control bytes so that a group can be read at every position
+	 */
+	uint8_t *control_bytes;
+
+	/* The entries, one per position
+	 */
+	libfcache_flat_table_entry_t *entries;
+
+	/* The positions, one per slot, contains -1 if the slot is not stored
+	 */
+	int32_t *positions;
+};
+
+int libfcache_flat_table_allocate(
+     int number_of_slots,
+     uint32_t *number_of_positions,
+     uint8_t **control_bytes,
+     libfcache_flat_table_entry_t **entries,
+     int32_t **positions,
+     libcerror_error_t **error );
+
+int libfcache_flat_table_initialize(
+     libfcache_flat_table_t **flat_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_flat_table_free(
+     libfcache_flat_table_t **flat_table,
+     libcerror_error_t **error );
+
+int libfcache_flat_table_clear(
+     libfcache_flat_table_t *flat_table,
+     libcerror_error_t **error );
+
+int libfcache_flat_table_rebuild(
+     libfcache_flat_table_t *flat_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_flat_table_resize(
+     libfcache_flat_table_t *flat_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+uint32_t libfcache_flat_table_get_group_match_mask(
+          const uint8_t *group,
+          uint8_t control_byte );
+
+uint32_t libfcache_flat_table_get_group_free_mask(
+          const uint8_t *group );
+
+int libfcache_flat_table_get_slot_by_identifier(
+     libfcache_flat_table_t *flat_table,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *slot,
+     libcerror_error_t **error );
+
+int libfcache_flat_table_insert_slot(
+     libfcache_flat_table_t *flat_table,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_flat_table_remove_slot(
+     libfcache_flat_table_t *flat_table,
+     int slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_FLAT_TABLE_H ) */
+
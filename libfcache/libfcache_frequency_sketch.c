@@ -0,0 +1,477 @@
+/*
+ * Frequency sketch functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_frequency_sketch.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+
+
+/* The multipliers used to derive the counter index of each row from the hash
+ */
+static const uint32_t libfcache_frequency_sketch_row_multipliers[ LIBFCACHE_FREQUENCY_SKETCH_NUMBER_OF_ROWS ] = {
+	0x9e3779b1UL, 0x85ebca77UL, 0xc2b2ae3dUL, 0x27d4eb2fUL };
+
+/* Allocates the counters for a specific number of slots
+ * The counters are cleared
+ * Returns 1 if successful or -1 on error
+ */
+static int libfcache_frequency_sketch_allocate_counters(
+            libfcache_frequency_sketch_t *frequency_sketch,
+            int number_of_slots,
+            libcerror_error_t **error )
+{
+	static char *function       = "libfcache_frequency_sketch_allocate_counters";
+	void *reallocation          = NULL;
+	size_t counters_size        = 0;
+	uint32_t number_of_counters = LIBFCACHE_FREQUENCY_SKETCH_MINIMUM_NUMBER_OF_COUNTERS;
+	uint8_t counter_shift       = 32;
+
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint32_t) number_of_slots > LIBFCACHE_FREQUENCY_SKETCH_MAXIMUM_NUMBER_OF_COUNTERS )
+	{
+		number_of_slots = (int) LIBFCACHE_FREQUENCY_SKETCH_MAXIMUM_NUMBER_OF_COUNTERS;
+	}
+	while( number_of_counters < (uint32_t) number_of_slots )
+	{
+		number_of_counters <<= 1;
+	}
+	while( ( (uint32_t) 1 << ( 32 - counter_shift ) ) < number_of_counters )
+	{
+		counter_shift--;
+	}
+	/* Each 64-bit word contains 16 counters
+	 */
+	counters_size = sizeof( uint64_t ) * ( number_of_counters / 16 ) * LIBFCACHE_FREQUENCY_SKETCH_NUMBER_OF_ROWS;
+
+	reallocation = memory_reallocate(
+	                frequency_sketch->counters,
+	                counters_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create counters.",
+		 function );
+
+		return( -1 );
+	}
+	frequency_sketch->counters = (uint64_t *) reallocation;
+
+	if( memory_set(
+	     frequency_sketch->counters,
+	     0,
+	     counters_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear counters.",
+		 function );
+
+		return( -1 );
+	}
+	frequency_sketch->number_of_counters   = number_of_counters;
+	frequency_sketch->counter_shift        = counter_shift;
+	frequency_sketch->number_of_increments = 0;
+
+	/* Age the counters after about 10 increments per counter
+	 */
+	frequency_sketch->sample_size = number_of_counters * 10;
+
+	return( 1 );
+}
+
+/* Creates a frequency sketch
+ * Make sure the value frequency_sketch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_frequency_sketch_initialize(
+     libfcache_frequency_sketch_t **frequency_sketch,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_frequency_sketch_t *safe_frequency_sketch = NULL;
+	static char *function                               = "libfcache_frequency_sketch_initialize";
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *frequency_sketch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid frequency sketch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	safe_frequency_sketch = memory_allocate_structure(
+	                         libfcache_frequency_sketch_t );
+
+	if( safe_frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create frequency sketch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_frequency_sketch,
+	     0,
+	     sizeof( libfcache_frequency_sketch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frequency sketch.",
+		 function );
+
+		memory_free(
+		 safe_frequency_sketch );
+
+		return( -1 );
+	}
+	if( libfcache_frequency_sketch_allocate_counters(
+	     safe_frequency_sketch,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate counters.",
+		 function );
+
+		goto on_error;
+	}
+	*frequency_sketch = safe_frequency_sketch;
+
+	return( 1 );
+
+on_error:
+	if( safe_frequency_sketch != NULL )
+	{
+		if( safe_frequency_sketch->counters != NULL )
+		{
+			memory_free(
+			 safe_frequency_sketch->counters );
+		}
+		memory_free(
+		 safe_frequency_sketch );
+	}
+	return( -1 );
+}
+
+/* Frees a frequency sketch
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_frequency_sketch_free(
+     libfcache_frequency_sketch_t **frequency_sketch,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_frequency_sketch_free";
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *frequency_sketch != NULL )
+	{
+		if( ( *frequency_sketch )->counters != NULL )
+		{
+			memory_free(
+			 ( *frequency_sketch )->counters );
+		}
+		memory_free(
+		 *frequency_sketch );
+
+		*frequency_sketch = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the frequency sketch
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_frequency_sketch_clear(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_frequency_sketch_clear";
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     frequency_sketch->counters,
+	     0,
+	     sizeof( uint64_t ) * ( frequency_sketch->number_of_counters / 16 ) * LIBFCACHE_FREQUENCY_SKETCH_NUMBER_OF_ROWS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear counters.",
+		 function );
+
+		return( -1 );
+	}
+	frequency_sketch->number_of_increments = 0;
+
+	return( 1 );
+}
+
+/* Resizes the frequency sketch
+ * The counters are cleared since their positions depend on the number of counters
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_frequency_sketch_resize(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_frequency_sketch_resize";
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_frequency_sketch_allocate_counters(
+	     frequency_sketch,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to allocate counters.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Increments the counters of an identifier
+ * The counters are aged, halved, when the number of increments reaches the sample size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_frequency_sketch_increment(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     int file_index,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfcache_frequency_sketch_increment";
+	uint64_t *word          = NULL;
+	uint32_t counter_index  = 0;
+	uint32_t hash           = 0;
+	uint32_t word_index     = 0;
+	uint8_t bit_shift       = 0;
+	uint8_t row_index       = 0;
+	uint8_t was_incremented = 0;
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfcache_hash_table_calculate_hash(
+	        file_index,
+	        offset,
+	        0 );
+
+	for( row_index = 0;
+	     row_index < LIBFCACHE_FREQUENCY_SKETCH_NUMBER_OF_ROWS;
+	     row_index++ )
+	{
+		counter_index = ( hash * libfcache_frequency_sketch_row_multipliers[ row_index ] ) >> frequency_sketch->counter_shift;
+		word_index    = ( row_index * ( frequency_sketch->number_of_counters / 16 ) ) + ( counter_index / 16 );
+		bit_shift     = (uint8_t) ( ( counter_index % 16 ) * 4 );
+		word          = &( frequency_sketch->counters[ word_index ] );
+
+		if( ( ( *word >> bit_shift ) & 0x0f ) < LIBFCACHE_FREQUENCY_SKETCH_MAXIMUM_COUNTER_VALUE )
+		{
+			*word += (uint64_t) 1 << bit_shift;
+
+			was_incremented = 1;
+		}
+	}
+	if( was_incremented != 0 )
+	{
+		frequency_sketch->number_of_increments += 1;
+
+		if( frequency_sketch->number_of_increments >= frequency_sketch->sample_size )
+		{
+			for( word_index = 0;
+			     word_index < ( frequency_sketch->number_of_counters / 16 ) * LIBFCACHE_FREQUENCY_SKETCH_NUMBER_OF_ROWS;
+			     word_index++ )
+			{
+				frequency_sketch->counters[ word_index ] = ( frequency_sketch->counters[ word_index ] >> 1 ) & 0x7777777777777777ULL;
+			}
+			frequency_sketch->number_of_increments /= 2;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the estimated frequency of an identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_frequency_sketch_get_estimate(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     int file_index,
+     off64_t offset,
+     uint8_t *estimate,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfcache_frequency_sketch_get_estimate";
+	uint32_t counter_index = 0;
+	uint32_t hash          = 0;
+	uint32_t word_index    = 0;
+	uint8_t bit_shift      = 0;
+	uint8_t counter_value  = 0;
+	uint8_t row_index      = 0;
+	uint8_t safe_estimate  = LIBFCACHE_FREQUENCY_SKETCH_MAXIMUM_COUNTER_VALUE;
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( estimate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid estimate.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfcache_hash_table_calculate_hash(
+	        file_index,
+	        offset,
+	        0 );
+
+	/* The estimate is the minimum of the counters of all rows
+	 */
+	for( row_index = 0;
+	     row_index < LIBFCACHE_FREQUENCY_SKETCH_NUMBER_OF_ROWS;
+	     row_index++ )
+	{
+		counter_index = ( hash * libfcache_frequency_sketch_row_multipliers[ row_index ] ) >> frequency_sketch->counter_shift;
+		word_index    = ( row_index * ( frequency_sketch->number_of_counters / 16 ) ) + ( counter_index / 16 );
+		bit_shift     = (uint8_t) ( ( counter_index % 16 ) * 4 );
+		counter_value = (uint8_t) ( ( frequency_sketch->counters[ word_index ] >> bit_shift ) & 0x0f );
+
+		if( counter_value < safe_estimate )
+		{
+			safe_estimate = counter_value;
+		}
+	}
+	*estimate = safe_estimate;
+
+	return( 1 );
+}
+
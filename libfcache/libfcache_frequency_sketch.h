@@ -0,0 +1,95 @@
+/*
+ * Frequency sketch functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_FREQUENCY_SKETCH_H )
+#define _LIBFCACHE_FREQUENCY_SKETCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_frequency_sketch libfcache_frequency_sketch_t;
+
+struct libfcache_frequency_sketch
+{
+	/* The number of counters per row, a power of 2
+	 */
+	uint32_t number_of_counters;
+
+	/* The shift to map a hash onto a counter
+	 */
+	uint8_t counter_shift;
+
+	/* The counters, 4-bit counters packed in 64-bit words, one row per hash function
+	 */
+	uint64_t *counters;
+
+	/* The number of increments since the counters were last aged
+	 */
+	uint32_t number_of_increments;
+
+	/* The number of increments after which the counters are aged
+	 */
+	uint32_t sample_size;
+};
+
+int libfcache_frequency_sketch_initialize(
+     libfcache_frequency_sketch_t **frequency_sketch,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_frequency_sketch_free(
+     libfcache_frequency_sketch_t **frequency_sketch,
+     libcerror_error_t **error );
+
+int libfcache_frequency_sketch_clear(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     libcerror_error_t **error );
+
+int libfcache_frequency_sketch_resize(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_frequency_sketch_increment(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     int file_index,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libfcache_frequency_sketch_get_estimate(
+     libfcache_frequency_sketch_t *frequency_sketch,
+     int file_index,
+     off64_t offset,
+     uint8_t *estimate,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_FREQUENCY_SKETCH_H ) */
+
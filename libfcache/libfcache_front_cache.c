@@ -0,0 +1,456 @@
+/*
+ * The front cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_cache.h"
+#include "libfcache_date_time.h"
+#include "libfcache_definitions.h"
+#include "libfcache_front_cache.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_types.h"
+
+/* Creates a front cache
+ * A front cache contains the most recently retrieved values of a (shared) cache
+ * and is intended to be used by a single thread
+ * Make sure the value front_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_front_cache_initialize(
+     libfcache_front_cache_t **front_cache,
+     libfcache_cache_t *cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libfcache_internal_front_cache_t *internal_front_cache = NULL;
+	static char *function                                  = "libfcache_front_cache_initialize";
+	uint32_t generation                                    = 0;
+
+	if( front_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *front_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid front cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > LIBFCACHE_FRONT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_internal_cache_get_generation(
+	     (libfcache_internal_cache_t *) cache,
+	     &generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve generation of cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_front_cache = memory_allocate_structure(
+	                        libfcache_internal_front_cache_t );
+
+	if( internal_front_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create front cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_front_cache,
+	     0,
+	     sizeof( libfcache_internal_front_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear front cache.",
+		 function );
+
+		memory_free(
+		 internal_front_cache );
+
+		return( -1 );
+	}
+	internal_front_cache->cache             = cache;
+	internal_front_cache->number_of_entries = number_of_entries;
+	internal_front_cache->generation        = generation;
+
+	*front_cache = (libfcache_front_cache_t *) internal_front_cache;
+
+	return( 1 );
+}
+
+/* Frees a front cache
+ * The (shared) cache is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_front_cache_free(
+     libfcache_front_cache_t **front_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_front_cache_free";
+
+	if( front_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *front_cache != NULL )
+	{
+		memory_free(
+		 *front_cache );
+
+		*front_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties the front cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_front_cache_empty(
+     libfcache_front_cache_t *front_cache,
+     libcerror_error_t **error )
+{
+	libfcache_internal_front_cache_t *internal_front_cache = NULL;
+	static char *function                                  = "libfcache_front_cache_empty";
+	uint32_t generation                                    = 0;
+
+	if( front_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_front_cache = (libfcache_internal_front_cache_t *) front_cache;
+
+	if( libfcache_internal_cache_get_generation(
+	     (libfcache_internal_cache_t *) internal_front_cache->cache,
+	     &generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve generation of cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_internal_front_cache_empty(
+	     internal_front_cache,
+	     generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty front cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Empties the front cache and sets the generation of the cache the entries are valid for
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_front_cache_empty(
+     libfcache_internal_front_cache_t *internal_front_cache,
+     uint32_t generation,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_front_cache_empty";
+
+	if( internal_front_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_front_cache->entries,
+	     0,
+	     sizeof( libfcache_front_cache_entry_t ) * LIBFCACHE_FRONT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		return( -1 );
+	}
+	internal_front_cache->next_entry_index = 0;
+	internal_front_cache->generation       = generation;
+
+	return( 1 );
+}
+
+/* Retrieves the cache value that matches the file index, offset and timestamp
+ * The front cache is checked first without accessing the (shared) cache, other than
+ * to determine if the cache was modified since the front cache was filled
+ * A value retrieved from the front cache is not promoted in the (shared) cache
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_front_cache_get_value_by_identifier(
+     libfcache_front_cache_t *front_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_front_cache_entry_t *entry                   = NULL;
+	libfcache_internal_front_cache_t *internal_front_cache = NULL;
+	static char *function                                  = "libfcache_front_cache_get_value_by_identifier";
+	int64_t current_timestamp                              = 0;
+	int64_t expiry_timestamp                               = 0;
+	uint32_t generation                                    = 0;
+	int entry_index                                        = 0;
+	int result                                             = 0;
+
+	if( front_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_front_cache = (libfcache_internal_front_cache_t *) front_cache;
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_value = NULL;
+
+	if( libfcache_internal_cache_get_generation(
+	     (libfcache_internal_cache_t *) internal_front_cache->cache,
+	     &generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve generation of cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entries are no longer valid if a value was evicted or replaced in the cache
+	 */
+	if( generation != internal_front_cache->generation )
+	{
+		if( libfcache_internal_front_cache_empty(
+		     internal_front_cache,
+		     generation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty front cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < internal_front_cache->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_front_cache->entries[ entry_index ] );
+
+		if( ( entry->cache_value == NULL )
+		 || ( entry->file_index != file_index )
+		 || ( entry->offset != offset )
+		 || ( entry->timestamp != timestamp ) )
+		{
+			continue;
+		}
+		if( entry->expiry_timestamp != 0 )
+		{
+			if( libfcache_date_time_get_timestamp(
+			     &current_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current timestamp.",
+				 function );
+
+				return( -1 );
+			}
+			/* An expired value is retrieved from the cache, which clears it
+			 */
+			if( current_timestamp >= entry->expiry_timestamp )
+			{
+				entry->cache_value = NULL;
+
+				break;
+			}
+		}
+		*cache_value = entry->cache_value;
+
+		return( 1 );
+	}
+	result = libfcache_cache_get_value_with_generation_by_identifier(
+	          internal_front_cache->cache,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          &expiry_timestamp,
+	          &generation,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value by identifier from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( generation != internal_front_cache->generation )
+	{
+		if( libfcache_internal_front_cache_empty(
+		     internal_front_cache,
+		     generation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty front cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry = &( internal_front_cache->entries[ internal_front_cache->next_entry_index ] );
+
+	entry->file_index       = file_index;
+	entry->offset           = offset;
+	entry->timestamp        = timestamp;
+	entry->expiry_timestamp = expiry_timestamp;
+	entry->cache_value      = *cache_value;
+
+	internal_front_cache->next_entry_index += 1;
+
+	if( internal_front_cache->next_entry_index >= internal_front_cache->number_of_entries )
+	{
+		internal_front_cache->next_entry_index = 0;
+	}
+	return( 1 );
+}
+
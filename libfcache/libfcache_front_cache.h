@@ -0,0 +1,123 @@
+/*
+ * The front cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_FRONT_CACHE_H )
+#define _LIBFCACHE_FRONT_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_extern.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_front_cache_entry libfcache_front_cache_entry_t;
+
+struct libfcache_front_cache_entry
+{
+	/* The file index
+	 */
+	int file_index;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The timestamp
+	 */
+	int64_t timestamp;
+
+	/* The expiry timestamp, contains 0 if the value does not expire
+	 */
+	int64_t expiry_timestamp;
+
+	/* The cache value, contains NULL if the entry is not set
+	 */
+	libfcache_cache_value_t *cache_value;
+};
+
+typedef struct libfcache_internal_front_cache libfcache_internal_front_cache_t;
+
+struct libfcache_internal_front_cache
+{
+	/* The (shared) cache the front cache is in front of
+	 */
+	libfcache_cache_t *cache;
+
+	/* The entries
+	 */
+	libfcache_front_cache_entry_t entries[ LIBFCACHE_FRONT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ];
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The index of the entry that is replaced next
+	 */
+	int next_entry_index;
+
+	/* The generation of the cache the entries are valid for
+	 */
+	uint32_t generation;
+};
+
+LIBFCACHE_EXTERN \
+int libfcache_front_cache_initialize(
+     libfcache_front_cache_t **front_cache,
+     libfcache_cache_t *cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_front_cache_free(
+     libfcache_front_cache_t **front_cache,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_front_cache_empty(
+     libfcache_front_cache_t *front_cache,
+     libcerror_error_t **error );
+
+int libfcache_internal_front_cache_empty(
+     libfcache_internal_front_cache_t *internal_front_cache,
+     uint32_t generation,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_front_cache_get_value_by_identifier(
+     libfcache_front_cache_t *front_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_FRONT_CACHE_H ) */
+
@@ -0,0 +1,810 @@
+/*
+ * GreedyDual-Size-Frequency replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_greedy_dual.h"
+#include "libfcache_libcerror.h"
+
+/* Sets the priority of a slot
+ * The priority is the inflation value plus the frequency times the cost per byte
+ * of the slot, where the cost per byte is a fixed-point value
+ */
+static void libfcache_greedy_dual_set_priority(
+             libfcache_greedy_dual_t *greedy_dual,
+             int slot )
+{
+	libfcache_greedy_dual_slot_t *greedy_dual_slot = NULL;
+	uint64_t priority                              = 0;
+	size_t value_size                              = 0;
+
+	greedy_dual_slot = &( greedy_dual->slots[ slot ] );
+
+	value_size = greedy_dual_slot->value_size;
+
+	if( value_size == 0 )
+	{
+		value_size = 1;
+	}
+	/* The frequency is 8-bit and the value cost 32-bit hence the product
+	 * still fits in 64-bit after it is shifted by the number of fraction bits
+	 */
+	priority = ( (uint64_t) greedy_dual_slot->frequency * greedy_dual_slot->value_cost ) << LIBFCACHE_GREEDY_DUAL_PRIORITY_FRACTION_BITS;
+	priority /= (uint64_t) value_size;
+
+	if( priority > ( LIBFCACHE_GREEDY_DUAL_MAXIMUM_PRIORITY - greedy_dual->inflation_value ) )
+	{
+		priority = LIBFCACHE_GREEDY_DUAL_MAXIMUM_PRIORITY;
+	}
+	else
+	{
+		priority += greedy_dual->inflation_value;
+	}
+	greedy_dual_slot->priority = priority;
+}
+
+/* Sets a slot at a specific index in the heap
+ */
+static void libfcache_greedy_dual_set_heap_slot(
+             libfcache_greedy_dual_t *greedy_dual,
+             int heap_index,
+             int slot )
+{
+	greedy_dual->heap[ heap_index ] = slot;
+
+	greedy_dual->slots[ slot ].heap_index = heap_index;
+}
+
+/* Moves the slot at a specific index in the heap up until its parent has a lower or equal priority
+ */
+static void libfcache_greedy_dual_move_heap_slot_up(
+             libfcache_greedy_dual_t *greedy_dual,
+             int heap_index )
+{
+	uint64_t priority = 0;
+	int parent_index  = 0;
+	int slot          = 0;
+
+	slot     = greedy_dual->heap[ heap_index ];
+	priority = greedy_dual->slots[ slot ].priority;
+
+	while( heap_index > 0 )
+	{
+		parent_index = ( heap_index - 1 ) / 2;
+
+		if( greedy_dual->slots[ greedy_dual->heap[ parent_index ] ].priority <= priority )
+		{
+			break;
+		}
+		libfcache_greedy_dual_set_heap_slot(
+		 greedy_dual,
+		 heap_index,
+		 greedy_dual->heap[ parent_index ] );
+
+		heap_index = parent_index;
+	}
+	libfcache_greedy_dual_set_heap_slot(
+	 greedy_dual,
+	 heap_index,
+	 slot );
+}
+
+/* Moves the slot at a specific index in the heap down until its children have a higher or equal priority
+ */
+static void libfcache_greedy_dual_move_heap_slot_down(
+             libfcache_greedy_dual_t *greedy_dual,
+             int heap_index )
+{
+	uint64_t priority = 0;
+	int child_index   = 0;
+	int slot          = 0;
+
+	slot     = greedy_dual->heap[ heap_index ];
+	priority = greedy_dual->slots[ slot ].priority;
+
+	while( heap_index < ( greedy_dual->heap_size / 2 ) )
+	{
+		child_index = ( heap_index * 2 ) + 1;
+
+		if( ( ( child_index + 1 ) < greedy_dual->heap_size )
+		 && ( greedy_dual->slots[ greedy_dual->heap[ child_index + 1 ] ].priority < greedy_dual->slots[ greedy_dual->heap[ child_index ] ].priority ) )
+		{
+			child_index += 1;
+		}
+		if( priority <= greedy_dual->slots[ greedy_dual->heap[ child_index ] ].priority )
+		{
+			break;
+		}
+		libfcache_greedy_dual_set_heap_slot(
+		 greedy_dual,
+		 heap_index,
+		 greedy_dual->heap[ child_index ] );
+
+		heap_index = child_index;
+	}
+	libfcache_greedy_dual_set_heap_slot(
+	 greedy_dual,
+	 heap_index,
+	 slot );
+}
+
+/* Creates a GreedyDual-Size-Frequency
+ * Make sure the value greedy_dual is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_initialize(
+     libfcache_greedy_dual_t **greedy_dual,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_greedy_dual_t *safe_greedy_dual = NULL;
+	static char *function                     = "libfcache_greedy_dual_initialize";
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( *greedy_dual != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid GreedyDual-Size-Frequency value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfcache_greedy_dual_slot_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_greedy_dual = memory_allocate_structure(
+	                    libfcache_greedy_dual_t );
+
+	if( safe_greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create GreedyDual-Size-Frequency.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_greedy_dual,
+	     0,
+	     sizeof( libfcache_greedy_dual_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear GreedyDual-Size-Frequency.",
+		 function );
+
+		memory_free(
+		 safe_greedy_dual );
+
+		return( -1 );
+	}
+	safe_greedy_dual->slots = (libfcache_greedy_dual_slot_t *) memory_allocate(
+	                                                            sizeof( libfcache_greedy_dual_slot_t ) * number_of_slots );
+
+	if( safe_greedy_dual->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	safe_greedy_dual->heap = (int *) memory_allocate(
+	                                  sizeof( int ) * number_of_slots );
+
+	if( safe_greedy_dual->heap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create heap.",
+		 function );
+
+		goto on_error;
+	}
+	safe_greedy_dual->number_of_slots = number_of_slots;
+
+	if( libfcache_greedy_dual_clear(
+	     safe_greedy_dual,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear GreedyDual-Size-Frequency.",
+		 function );
+
+		goto on_error;
+	}
+	*greedy_dual = safe_greedy_dual;
+
+	return( 1 );
+
+on_error:
+	if( safe_greedy_dual != NULL )
+	{
+		if( safe_greedy_dual->heap != NULL )
+		{
+			memory_free(
+			 safe_greedy_dual->heap );
+		}
+		if( safe_greedy_dual->slots != NULL )
+		{
+			memory_free(
+			 safe_greedy_dual->slots );
+		}
+		memory_free(
+		 safe_greedy_dual );
+	}
+	return( -1 );
+}
+
+/* Frees a GreedyDual-Size-Frequency
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_free(
+     libfcache_greedy_dual_t **greedy_dual,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_free";
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( *greedy_dual != NULL )
+	{
+		if( ( *greedy_dual )->heap != NULL )
+		{
+			memory_free(
+			 ( *greedy_dual )->heap );
+		}
+		if( ( *greedy_dual )->slots != NULL )
+		{
+			memory_free(
+			 ( *greedy_dual )->slots );
+		}
+		memory_free(
+		 *greedy_dual );
+
+		*greedy_dual = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the GreedyDual-Size-Frequency
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_clear(
+     libfcache_greedy_dual_t *greedy_dual,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_clear";
+	int slot              = 0;
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     greedy_dual->slots,
+	     0,
+	     sizeof( libfcache_greedy_dual_slot_t ) * greedy_dual->number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot = 0;
+	     slot < greedy_dual->number_of_slots;
+	     slot++ )
+	{
+		greedy_dual->slots[ slot ].value_cost = 1;
+		greedy_dual->slots[ slot ].heap_index = -1;
+	}
+	greedy_dual->heap_size       = 0;
+	greedy_dual->inflation_value = 0;
+
+	return( 1 );
+}
+
+/* Resizes the GreedyDual-Size-Frequency
+ * The slots that remain retain their priority
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_resize(
+     libfcache_greedy_dual_t *greedy_dual,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_resize";
+	void *reallocation    = NULL;
+	int heap_index        = 0;
+	int heap_size         = 0;
+	int slot              = 0;
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfcache_greedy_dual_slot_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Remove the slots that no longer fit from the heap before the heap is reallocated
+	 */
+	if( number_of_slots < greedy_dual->number_of_slots )
+	{
+		for( heap_index = 0;
+		     heap_index < greedy_dual->heap_size;
+		     heap_index++ )
+		{
+			slot = greedy_dual->heap[ heap_index ];
+
+			if( slot < number_of_slots )
+			{
+				greedy_dual->heap[ heap_size++ ] = slot;
+			}
+		}
+		greedy_dual->heap_size = heap_size;
+	}
+	reallocation = memory_reallocate(
+	                greedy_dual->slots,
+	                sizeof( libfcache_greedy_dual_slot_t ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize slots.",
+		 function );
+
+		return( -1 );
+	}
+	greedy_dual->slots = (libfcache_greedy_dual_slot_t *) reallocation;
+
+	reallocation = memory_reallocate(
+	                greedy_dual->heap,
+	                sizeof( int ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize heap.",
+		 function );
+
+		return( -1 );
+	}
+	greedy_dual->heap = (int *) reallocation;
+
+	for( slot = greedy_dual->number_of_slots;
+	     slot < number_of_slots;
+	     slot++ )
+	{
+		greedy_dual->slots[ slot ].priority   = 0;
+		greedy_dual->slots[ slot ].value_size = 0;
+		greedy_dual->slots[ slot ].value_cost = 1;
+		greedy_dual->slots[ slot ].frequency  = 0;
+		greedy_dual->slots[ slot ].heap_index = -1;
+	}
+	greedy_dual->number_of_slots = number_of_slots;
+
+	/* Restore the heap order after slots were removed
+	 */
+	for( heap_index = ( greedy_dual->heap_size / 2 ) - 1;
+	     heap_index >= 0;
+	     heap_index-- )
+	{
+		libfcache_greedy_dual_move_heap_slot_down(
+		 greedy_dual,
+		 heap_index );
+	}
+	for( heap_index = 0;
+	     heap_index < greedy_dual->heap_size;
+	     heap_index++ )
+	{
+		greedy_dual->slots[ greedy_dual->heap[ heap_index ] ].heap_index = heap_index;
+	}
+	return( 1 );
+}
+
+/* Sets the value size and cost of a slot
+ * The value size and cost are used to determine the priority when the slot is inserted
+ * A value cost of 0 is stored as 1
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_set_slot_cost(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     size_t value_size,
+     uint32_t value_cost,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_set_slot_cost";
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= greedy_dual->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_cost == 0 )
+	{
+		value_cost = 1;
+	}
+	greedy_dual->slots[ slot ].value_size = value_size;
+	greedy_dual->slots[ slot ].value_cost = value_cost;
+
+	return( 1 );
+}
+
+/* Inserts a slot
+ * The frequency of a newly inserted slot is 1
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_insert_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_insert_slot";
+	int heap_index        = 0;
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= greedy_dual->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	greedy_dual->slots[ slot ].frequency = 1;
+
+	libfcache_greedy_dual_set_priority(
+	 greedy_dual,
+	 slot );
+
+	heap_index = greedy_dual->slots[ slot ].heap_index;
+
+	if( heap_index == -1 )
+	{
+		heap_index = greedy_dual->heap_size;
+
+		greedy_dual->heap_size += 1;
+
+		libfcache_greedy_dual_set_heap_slot(
+		 greedy_dual,
+		 heap_index,
+		 slot );
+	}
+	libfcache_greedy_dual_move_heap_slot_up(
+	 greedy_dual,
+	 heap_index );
+
+	libfcache_greedy_dual_move_heap_slot_down(
+	 greedy_dual,
+	 greedy_dual->slots[ slot ].heap_index );
+
+	return( 1 );
+}
+
+/* Marks a slot as referenced
+ * The frequency of the slot is increased and its priority is renewed
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_reference_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_reference_slot";
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= greedy_dual->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( greedy_dual->slots[ slot ].heap_index == -1 )
+	{
+		return( 1 );
+	}
+	if( greedy_dual->slots[ slot ].frequency < LIBFCACHE_GREEDY_DUAL_MAXIMUM_FREQUENCY )
+	{
+		greedy_dual->slots[ slot ].frequency += 1;
+	}
+	libfcache_greedy_dual_set_priority(
+	 greedy_dual,
+	 slot );
+
+	/* The inflation value does not decrease hence the priority of the slot does not decrease
+	 */
+	libfcache_greedy_dual_move_heap_slot_down(
+	 greedy_dual,
+	 greedy_dual->slots[ slot ].heap_index );
+
+	return( 1 );
+}
+
+/* Removes a slot
+ * If the slot has the lowest priority the inflation value is set to its priority,
+ * which ages the priority of the remaining slots
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_remove_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_remove_slot";
+	int heap_index        = 0;
+	int last_slot         = 0;
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= greedy_dual->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	heap_index = greedy_dual->slots[ slot ].heap_index;
+
+	if( heap_index == -1 )
+	{
+		return( 1 );
+	}
+	if( heap_index == 0 )
+	{
+		greedy_dual->inflation_value = greedy_dual->slots[ slot ].priority;
+	}
+	greedy_dual->slots[ slot ].frequency  = 0;
+	greedy_dual->slots[ slot ].heap_index = -1;
+
+	greedy_dual->heap_size -= 1;
+
+	if( heap_index < greedy_dual->heap_size )
+	{
+		last_slot = greedy_dual->heap[ greedy_dual->heap_size ];
+
+		libfcache_greedy_dual_set_heap_slot(
+		 greedy_dual,
+		 heap_index,
+		 last_slot );
+
+		libfcache_greedy_dual_move_heap_slot_up(
+		 greedy_dual,
+		 heap_index );
+
+		libfcache_greedy_dual_move_heap_slot_down(
+		 greedy_dual,
+		 greedy_dual->slots[ last_slot ].heap_index );
+	}
+	return( 1 );
+}
+
+/* Retrieves the slot to reuse
+ * The slot to reuse is the slot with the lowest priority
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_greedy_dual_get_victim_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_greedy_dual_get_victim_slot";
+
+	if( greedy_dual == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GreedyDual-Size-Frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( greedy_dual->heap_size <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid GreedyDual-Size-Frequency - missing slots.",
+		 function );
+
+		return( -1 );
+	}
+	*slot = greedy_dual->heap[ 0 ];
+
+	return( 1 );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * GreedyDual-Size-Frequency replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_GREEDY_DUAL_H )
+#define _LIBFCACHE_GREEDY_DUAL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_greedy_dual_slot libfcache_greedy_dual_slot_t;
+
+struct libfcache_greedy_dual_slot
+{
+	/* The priority, the inflation value at the time the slot was inserted
+	 * or referenced plus its frequency times cost per byte
+	 */
+	uint64_t priority;
+
+	/* The value size
+	 */
+	size_t value_size;
+
+	/* The value cost, the cost to reload the value
+	 */
+	uint32_t value_cost;
+
+	/* The frequency, the number of times the slot was inserted or referenced
+	 */
+	uint8_t frequency;
+
+	/* The index of the slot in the heap, contains -1 if not set
+	 */
+	int heap_index;
+};
+
+typedef struct libfcache_greedy_dual libfcache_greedy_dual_t;
+
+struct libfcache_greedy_dual
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The slots
+	 */
+	libfcache_greedy_dual_slot_t *slots;
+
+	/* The heap, a binary min-heap of the inserted slots ordered by priority
+	 */
+	int *heap;
+
+	/* The number of slots in the heap
+	 */
+	int heap_size;
+
+	/* The inflation value, the priority of the slot that was evicted most recently
+	 */
+	uint64_t inflation_value;
+};
+
+int libfcache_greedy_dual_initialize(
+     libfcache_greedy_dual_t **greedy_dual,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_free(
+     libfcache_greedy_dual_t **greedy_dual,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_clear(
+     libfcache_greedy_dual_t *greedy_dual,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_resize(
+     libfcache_greedy_dual_t *greedy_dual,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_set_slot_cost(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     size_t value_size,
+     uint32_t value_cost,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_insert_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_reference_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_remove_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_greedy_dual_get_victim_slot(
+     libfcache_greedy_dual_t *greedy_dual,
+     int *slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_GREEDY_DUAL_H ) */
+
@@ -0,0 +1,659 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+
+/* Allocates the buckets and entries of the hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hash_table_allocate(
+     int number_of_slots,
+     int **buckets,
+     uint32_t *bucket_mask,
+     libfcache_hash_table_entry_t **entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfcache_hash_table_allocate";
+	size_t buckets_size        = 0;
+	size_t entries_size        = 0;
+	uint32_t bucket_index      = 0;
+	uint32_t number_of_buckets = 1;
+	int slot                   = 0;
+
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfcache_hash_table_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a power of 2 number of buckets so that the bucket can be determined
+	 * with a mask, the load factor is at most 1
+	 */
+	while( number_of_buckets < (uint32_t) number_of_slots )
+	{
+		number_of_buckets <<= 1;
+	}
+	buckets_size = sizeof( int ) * number_of_buckets;
+	entries_size = sizeof( libfcache_hash_table_entry_t ) * number_of_slots;
+
+	*buckets = (int *) memory_allocate(
+	                    buckets_size );
+
+	if( *buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	*entries = (libfcache_hash_table_entry_t *) memory_allocate(
+	                                             entries_size );
+
+	if( *entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		( *buckets )[ bucket_index ] = -1;
+	}
+	for( slot = 0;
+	     slot < number_of_slots;
+	     slot++ )
+	{
+		( *entries )[ slot ].next_slot = LIBFCACHE_HASH_TABLE_SLOT_NOT_SET;
+	}
+	*bucket_mask = number_of_buckets - 1;
+
+	return( 1 );
+
+on_error:
+	if( *entries != NULL )
+	{
+		memory_free(
+		 *entries );
+
+		*entries = NULL;
+	}
+	if( *buckets != NULL )
+	{
+		memory_free(
+		 *buckets );
+
+		*buckets = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a hash table
+ * Make sure the value hash_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hash_table_initialize(
+     libfcache_hash_table_t **hash_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_hash_table_t *safe_hash_table = NULL;
+	static char *function                   = "libfcache_hash_table_initialize";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	safe_hash_table = memory_allocate_structure(
+	                   libfcache_hash_table_t );
+
+	if( safe_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_hash_table,
+	     0,
+	     sizeof( libfcache_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 safe_hash_table );
+
+		return( -1 );
+	}
+	if( libfcache_hash_table_allocate(
+	     number_of_slots,
+	     &( safe_hash_table->buckets ),
+	     &( safe_hash_table->bucket_mask ),
+	     &( safe_hash_table->entries ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate buckets and entries.",
+		 function );
+
+		goto on_error;
+	}
+	safe_hash_table->number_of_slots = number_of_slots;
+
+	*hash_table = safe_hash_table;
+
+	return( 1 );
+
+on_error:
+	if( safe_hash_table != NULL )
+	{
+		memory_free(
+		 safe_hash_table );
+	}
+	return( -1 );
+}
+
+/* Frees a hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hash_table_free(
+     libfcache_hash_table_t **hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_hash_table_free";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		if( ( *hash_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->entries );
+		}
+		if( ( *hash_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->buckets );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hash_table_clear(
+     libfcache_hash_table_t *hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_hash_table_clear";
+	uint32_t bucket_index = 0;
+	int slot              = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index <= hash_table->bucket_mask;
+	     bucket_index++ )
+	{
+		hash_table->buckets[ bucket_index ] = -1;
+	}
+	for( slot = 0;
+	     slot < hash_table->number_of_slots;
+	     slot++ )
+	{
+		hash_table->entries[ slot ].next_slot = LIBFCACHE_HASH_TABLE_SLOT_NOT_SET;
+	}
+	return( 1 );
+}
+
+/* Resizes the hash table
+ * The identifiers of the slots that remain are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hash_table_resize(
+     libfcache_hash_table_t *hash_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_hash_table_entry_t *entries = NULL;
+	libfcache_hash_table_entry_t *entry   = NULL;
+	static char *function                 = "libfcache_hash_table_resize";
+	uint32_t bucket_index                 = 0;
+	uint32_t bucket_mask                  = 0;
+	int *buckets                          = NULL;
+	int number_of_retained_slots          = 0;
+	int slot                              = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_hash_table_allocate(
+	     number_of_slots,
+	     &buckets,
+	     &bucket_mask,
+	     &entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to allocate buckets and entries.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_retained_slots = hash_table->number_of_slots;
+
+	if( number_of_retained_slots > number_of_slots )
+	{
+		number_of_retained_slots = number_of_slots;
+	}
+	for( slot = 0;
+	     slot < number_of_retained_slots;
+	     slot++ )
+	{
+		entry = &( hash_table->entries[ slot ] );
+
+		if( entry->next_slot == LIBFCACHE_HASH_TABLE_SLOT_NOT_SET )
+		{
+			continue;
+		}
+		bucket_index = libfcache_hash_table_calculate_hash(
+		                entry->file_index,
+		                entry->offset,
+		                entry->timestamp ) & bucket_mask;
+
+		entries[ slot ].file_index = entry->file_index;
+		entries[ slot ].offset     = entry->offset;
+		entries[ slot ].timestamp  = entry->timestamp;
+		entries[ slot ].next_slot  = buckets[ bucket_index ];
+		buckets[ bucket_index ]    = slot;
+	}
+	memory_free(
+	 hash_table->entries );
+
+	memory_free(
+	 hash_table->buckets );
+
+	hash_table->buckets         = buckets;
+	hash_table->bucket_mask     = bucket_mask;
+	hash_table->entries         = entries;
+	hash_table->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an identifier
+ * Returns the hash
+ */
+uint32_t libfcache_hash_table_calculate_hash(
+          int file_index,
+          off64_t offset,
+          int64_t timestamp )
+{
+	uint64_t hash = 0;
+
+	hash  = (uint64_t) offset;
+	hash ^= (uint64_t) (uint32_t) file_index * (uint64_t) 0x9e3779b97f4a7c15ULL;
+	hash ^= (uint64_t) timestamp * (uint64_t) 0xc2b2ae3d27d4eb4fULL;
+
+	/* Finalize the hash so that all input bits affect the lower bits
+	 */
+	hash ^= hash >> 33;
+	hash *= (uint64_t) 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= (uint64_t) 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	return( (uint32_t) hash );
+}
+
+/* Retrieves the slot that matches the identifier
+ * Returns 1 if successful, 0 if no such slot or -1 on error
+ */
+int libfcache_hash_table_get_slot_by_identifier(
+     libfcache_hash_table_t *hash_table,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *slot,
+     libcerror_error_t **error )
+{
+	libfcache_hash_table_entry_t *entry = NULL;
+	static char *function               = "libfcache_hash_table_get_slot_by_identifier";
+	uint32_t bucket_index               = 0;
+	int safe_slot                       = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libfcache_hash_table_calculate_hash(
+	                file_index,
+	                offset,
+	                timestamp ) & hash_table->bucket_mask;
+
+	safe_slot = hash_table->buckets[ bucket_index ];
+
+	while( safe_slot >= 0 )
+	{
+		entry = &( hash_table->entries[ safe_slot ] );
+
+		if( ( entry->offset == offset )
+		 && ( entry->file_index == file_index )
+		 && ( entry->timestamp == timestamp ) )
+		{
+			*slot = safe_slot;
+
+			return( 1 );
+		}
+		safe_slot = entry->next_slot;
+	}
+	return( 0 );
+}
+
+/* Inserts a slot with a specific identifier
+ * If the slot is already stored it is removed first
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hash_table_insert_slot(
+     libfcache_hash_table_t *hash_table,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	libfcache_hash_table_entry_t *entry = NULL;
+	static char *function               = "libfcache_hash_table_insert_slot";
+	uint32_t bucket_index               = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= hash_table->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( hash_table->entries[ slot ] );
+
+	if( entry->next_slot != LIBFCACHE_HASH_TABLE_SLOT_NOT_SET )
+	{
+		if( libfcache_hash_table_remove_slot(
+		     hash_table,
+		     slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove slot: %d.",
+			 function,
+			 slot );
+
+			return( -1 );
+		}
+	}
+	bucket_index = libfcache_hash_table_calculate_hash(
+	                file_index,
+	                offset,
+	                timestamp ) & hash_table->bucket_mask;
+
+	entry->file_index = file_index;
+	entry->offset     = offset;
+	entry->timestamp  = timestamp;
+
+	/* Prepend the slot so that the most recently stored identifier is found first
+	 */
+	entry->next_slot                     = hash_table->buckets[ bucket_index ];
+	hash_table->buckets[ bucket_index ] = slot;
+
+	return( 1 );
+}
+
+/* Removes a slot
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hash_table_remove_slot(
+     libfcache_hash_table_t *hash_table,
+     int slot,
+     libcerror_error_t **error )
+{
+	libfcache_hash_table_entry_t *entry = NULL;
+	static char *function               = "libfcache_hash_table_remove_slot";
+	uint32_t bucket_index               = 0;
+	int *previous_next_slot             = NULL;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= hash_table->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( hash_table->entries[ slot ] );
+
+	if( entry->next_slot == LIBFCACHE_HASH_TABLE_SLOT_NOT_SET )
+	{
+		return( 1 );
+	}
+	bucket_index = libfcache_hash_table_calculate_hash(
+	                entry->file_index,
+	                entry->offset,
+	                entry->timestamp ) & hash_table->bucket_mask;
+
+	previous_next_slot = &( hash_table->buckets[ bucket_index ] );
+
+	while( *previous_next_slot >= 0 )
+	{
+		if( *previous_next_slot == slot )
+		{
+			*previous_next_slot = entry->next_slot;
+			entry->next_slot    = LIBFCACHE_HASH_TABLE_SLOT_NOT_SET;
+
+			return( 1 );
+		}
+		previous_next_slot = &( hash_table->entries[ *previous_next_slot ].next_slot );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing slot: %d in bucket: %" PRIu32 ".",
+	 function,
+	 slot,
+	 bucket_index );
+
+	return( -1 );
+}
+
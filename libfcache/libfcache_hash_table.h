@@ -0,0 +1,134 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_HASH_TABLE_H )
+#define _LIBFCACHE_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_hash_table_entry libfcache_hash_table_entry_t;
+
+struct libfcache_hash_table_entry
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The timestamp
+	 */
+	int64_t timestamp;
+
+	/* The file index
+	 */
+	int file_index;
+
+	/* The next slot in the bucket chain
+	 * Contains -1 at the end of the chain or LIBFCACHE_HASH_TABLE_SLOT_NOT_SET
+	 * if the slot is not stored in the hash table
+	 */
+	int next_slot;
+};
+
+typedef struct libfcache_hash_table libfcache_hash_table_t;
+
+struct libfcache_hash_table
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The bucket mask, the number of buckets - 1
+	 */
+	uint32_t bucket_mask;
+
+	/* The buckets, each contains the first slot of its chain or -1
+	 */
+	int *buckets;
+
+	/* The entries, one per slot
+	 */
+	libfcache_hash_table_entry_t *entries;
+};
+
+int libfcache_hash_table_allocate(
+     int number_of_slots,
+     int **buckets,
+     uint32_t *bucket_mask,
+     libfcache_hash_table_entry_t **entries,
+     libcerror_error_t **error );
+
+int libfcache_hash_table_initialize(
+     libfcache_hash_table_t **hash_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_hash_table_free(
+     libfcache_hash_table_t **hash_table,
+     libcerror_error_t **error );
+
+int libfcache_hash_table_clear(
+     libfcache_hash_table_t *hash_table,
+     libcerror_error_t **error );
+
+int libfcache_hash_table_resize(
+     libfcache_hash_table_t *hash_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+uint32_t libfcache_hash_table_calculate_hash(
+          int file_index,
+          off64_t offset,
+          int64_t timestamp );
+
+int libfcache_hash_table_get_slot_by_identifier(
+     libfcache_hash_table_t *hash_table,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *slot,
+     libcerror_error_t **error );
+
+int libfcache_hash_table_insert_slot(
+     libfcache_hash_table_t *hash_table,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_hash_table_remove_slot(
+     libfcache_hash_table_t *hash_table,
+     int slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_HASH_TABLE_H ) */
+
@@ -0,0 +1,455 @@
+/*
+ * The hit buffers functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_hit_buffers.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_libcthreads.h"
+
+/* Creates hit buffers
+ * Make sure the value hit_buffers is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hit_buffers_initialize(
+     libfcache_hit_buffers_t **hit_buffers,
+     libcerror_error_t **error )
+{
+	libfcache_hit_buffers_t *safe_hit_buffers = NULL;
+	static char *function                     = "libfcache_hit_buffers_initialize";
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	int buffer_index                          = 0;
+#endif
+
+	if( hit_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hit_buffers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hit buffers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	safe_hit_buffers = memory_allocate_structure(
+	                    libfcache_hit_buffers_t );
+
+	if( safe_hit_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hit buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_hit_buffers,
+	     0,
+	     sizeof( libfcache_hit_buffers_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hit buffers.",
+		 function );
+
+		memory_free(
+		 safe_hit_buffers );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	for( buffer_index = 0;
+	     buffer_index < LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( safe_hit_buffers->buffers[ buffer_index ].mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex of hit buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+#endif
+	*hit_buffers = safe_hit_buffers;
+
+	return( 1 );
+
+on_error:
+	if( safe_hit_buffers != NULL )
+	{
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		for( buffer_index = 0;
+		     buffer_index < LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( safe_hit_buffers->buffers[ buffer_index ].mutex != NULL )
+			{
+				libcthreads_mutex_free(
+				 &( safe_hit_buffers->buffers[ buffer_index ].mutex ),
+				 NULL );
+			}
+		}
+#endif
+		memory_free(
+		 safe_hit_buffers );
+	}
+	return( -1 );
+}
+
+/* Frees hit buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hit_buffers_free(
+     libfcache_hit_buffers_t **hit_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_hit_buffers_free";
+	int result            = 1;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	int buffer_index      = 0;
+#endif
+
+	if( hit_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hit_buffers != NULL )
+	{
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		for( buffer_index = 0;
+		     buffer_index < LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *hit_buffers )->buffers[ buffer_index ].mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex of hit buffer: %d.",
+				 function,
+				 buffer_index );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *hit_buffers );
+
+		*hit_buffers = NULL;
+	}
+	return( result );
+}
+
+/* Clears the hit buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hit_buffers_clear(
+     libfcache_hit_buffers_t *hit_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_hit_buffers_clear";
+	int buffer_index      = 0;
+
+	if( hit_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     hit_buffers->buffers[ buffer_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex of hit buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+#endif
+		hit_buffers->buffers[ buffer_index ].number_of_slots = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     hit_buffers->buffers[ buffer_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex of hit buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( 1 );
+}
+
+/* Appends a slot to the hit buffer of its stripe
+ * The hit is dropped if the hit buffer is full or, to not block,
+ * if the hit buffer is in use by another thread
+ * Returns 1 if successful, 0 if the hit was dropped or -1 on error
+ */
+int libfcache_hit_buffers_append_slot(
+     libfcache_hit_buffers_t *hit_buffers,
+     int slot,
+     libcerror_error_t **error )
+{
+	libfcache_hit_buffer_t *hit_buffer = NULL;
+	static char *function              = "libfcache_hit_buffers_append_slot";
+	int result                         = 0;
+
+	if( hit_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid slot value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	hit_buffer = &( hit_buffers->buffers[ slot % LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS ] );
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	result = libcthreads_mutex_try_grab(
+	          hit_buffer->mutex,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex of hit buffer.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = 0;
+#endif
+	if( hit_buffer->number_of_slots < LIBFCACHE_HIT_BUFFERS_BUFFER_SIZE )
+	{
+		hit_buffer->slots[ hit_buffer->number_of_slots ] = slot;
+
+		hit_buffer->number_of_slots += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     hit_buffer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex of hit buffer.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes the slots from a specific hit buffer
+ * The slots must be able to contain LIBFCACHE_HIT_BUFFERS_BUFFER_SIZE slots
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_hit_buffers_remove_slots(
+     libfcache_hit_buffers_t *hit_buffers,
+     int buffer_index,
+     int *slots,
+     int *number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_hit_buffer_t *hit_buffer = NULL;
+	static char *function              = "libfcache_hit_buffers_remove_slots";
+	int slot_index                     = 0;
+
+	if( hit_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_index < 0 )
+	 || ( buffer_index >= LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of slots.",
+		 function );
+
+		return( -1 );
+	}
+	hit_buffer = &( hit_buffers->buffers[ buffer_index ] );
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     hit_buffer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex of hit buffer.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( slot_index = 0;
+	     slot_index < hit_buffer->number_of_slots;
+	     slot_index++ )
+	{
+		slots[ slot_index ] = hit_buffer->slots[ slot_index ];
+	}
+	*number_of_slots = hit_buffer->number_of_slots;
+
+	hit_buffer->number_of_slots = 0;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     hit_buffer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex of hit buffer.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,93 @@
+/*
+ * The hit buffers functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_HIT_BUFFERS_H )
+#define _LIBFCACHE_HIT_BUFFERS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_hit_buffer libfcache_hit_buffer_t;
+
+struct libfcache_hit_buffer
+{
+	/* The slots that were hit, in the order they were hit
+	 */
+	int slots[ LIBFCACHE_HIT_BUFFERS_BUFFER_SIZE ];
+
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libfcache_hit_buffers libfcache_hit_buffers_t;
+
+struct libfcache_hit_buffers
+{
+	/* The buffers, a slot is recorded in the buffer of its stripe
+	 */
+	libfcache_hit_buffer_t buffers[ LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS ];
+};
+
+int libfcache_hit_buffers_initialize(
+     libfcache_hit_buffers_t **hit_buffers,
+     libcerror_error_t **error );
+
+int libfcache_hit_buffers_free(
+     libfcache_hit_buffers_t **hit_buffers,
+     libcerror_error_t **error );
+
+int libfcache_hit_buffers_clear(
+     libfcache_hit_buffers_t *hit_buffers,
+     libcerror_error_t **error );
+
+int libfcache_hit_buffers_append_slot(
+     libfcache_hit_buffers_t *hit_buffers,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_hit_buffers_remove_slots(
+     libfcache_hit_buffers_t *hit_buffers,
+     int buffer_index,
+     int *slots,
+     int *number_of_slots,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_HIT_BUFFERS_H ) */
+
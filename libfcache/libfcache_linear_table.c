@@ -0,0 +1,806 @@
+/*
+ * Linear table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __AVX2__ )
+#define LIBFCACHE_LINEAR_TABLE_HAVE_AVX2	1
+#include <immintrin.h>
+
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#define LIBFCACHE_LINEAR_TABLE_HAVE_SSE2	1
+#include <emmintrin.h>
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#define LIBFCACHE_LINEAR_TABLE_HAVE_NEON	1
+#include <arm_neon.h>
+#endif
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+#include "libfcache_definitions.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_linear_table.h"
+
+/* Retrieves the index of the least significant bit set in a non-zero mask
+ * Returns the bit index
+ */
+static int libfcache_linear_table_get_first_bit_index(
+            uint64_t mask )
+{
+#if defined( __GNUC__ )
+	return( __builtin_ctzll( mask ) );
+
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+	unsigned long bit_index = 0;
+
+	_BitScanForward64(
+	 &bit_index,
+	 (unsigned __int64) mask );
+
+	return( (int) bit_index );
+#else
+	int bit_index = 0;
+
+	while( ( mask & 0x00000001UL ) == 0 )
+	{
+		mask >>= 1;
+
+		bit_index++;
+	}
+	return( bit_index );
+#endif
+}
+
+/* Allocates the offsets, timestamps, file indexes and slot is set values of the linear table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_linear_table_allocate(
+     int number_of_slots,
+     int *number_of_allocated_slots,
+     off64_t **offsets,
+     int64_t **timestamps,
+     int **file_indexes,
+     uint8_t **slot_is_set,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfcache_linear_table_allocate";
+	size_t file_indexes_size           = 0;
+	size_t offsets_size                = 0;
+	size_t slot_is_set_size            = 0;
+	size_t timestamps_size             = 0;
+	int safe_number_of_allocated_slots = 0;
+
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) - LIBFCACHE_LINEAR_TABLE_GROUP_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Allocate a multiple of the group size so that the offsets can be compared a group at a time
+	 */
+	safe_number_of_allocated_slots = number_of_slots;
+
+	if( ( safe_number_of_allocated_slots % LIBFCACHE_LINEAR_TABLE_GROUP_SIZE ) != 0 )
+	{
+		safe_number_of_allocated_slots += LIBFCACHE_LINEAR_TABLE_GROUP_SIZE - ( safe_number_of_allocated_slots % LIBFCACHE_LINEAR_TABLE_GROUP_SIZE );
+	}
+	offsets_size      = sizeof( off64_t ) * safe_number_of_allocated_slots;
+	timestamps_size   = sizeof( int64_t ) * safe_number_of_allocated_slots;
+	file_indexes_size = sizeof( int ) * safe_number_of_allocated_slots;
+	slot_is_set_size  = sizeof( uint8_t ) * safe_number_of_allocated_slots;
+
+	*offsets = (off64_t *) memory_allocate(
+	                        offsets_size );
+
+	if( *offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offsets.",
+		 function );
+
+		goto on_error;
+	}
+	*timestamps = (int64_t *) memory_allocate(
+	                           timestamps_size );
+
+	if( *timestamps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timestamps.",
+		 function );
+
+		goto on_error;
+	}
+	*file_indexes = (int *) memory_allocate(
+	                         file_indexes_size );
+
+	if( *file_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file indexes.",
+		 function );
+
+		goto on_error;
+	}
+	*slot_is_set = (uint8_t *) memory_allocate(
+	                            slot_is_set_size );
+
+	if( *slot_is_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot is set values.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( memory_set(
+	       *offsets,
+	       0,
+	       offsets_size ) == NULL )
+	 || ( memory_set(
+	       *timestamps,
+	       0,
+	       timestamps_size ) == NULL )
+	 || ( memory_set(
+	       *file_indexes,
+	       0,
+	       file_indexes_size ) == NULL )
+	 || ( memory_set(
+	       *slot_is_set,
+	       0,
+	       slot_is_set_size ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arrays.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_allocated_slots = safe_number_of_allocated_slots;
+
+	return( 1 );
+
+on_error:
+	if( *slot_is_set != NULL )
+	{
+		memory_free(
+		 *slot_is_set );
+
+		*slot_is_set = NULL;
+	}
+	if( *file_indexes != NULL )
+	{
+		memory_free(
+		 *file_indexes );
+
+		*file_indexes = NULL;
+	}
+	if( *timestamps != NULL )
+	{
+		memory_free(
+		 *timestamps );
+
+		*timestamps = NULL;
+	}
+	if( *offsets != NULL )
+	{
+		memory_free(
+		 *offsets );
+
+		*offsets = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a linear table
+ * Make sure the value linear_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_linear_table_initialize(
+     libfcache_linear_table_t **linear_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_linear_table_t *safe_linear_table = NULL;
+	static char *function                       = "libfcache_linear_table_initialize";
+
+	if( linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid linear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *linear_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid linear table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	safe_linear_table = memory_allocate_structure(
+	                     libfcache_linear_table_t );
+
+	if( safe_linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create linear table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_linear_table,
+	     0,
+	     sizeof( libfcache_linear_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear linear table.",
+		 function );
+
+		memory_free(
+		 safe_linear_table );
+
+		return( -1 );
+	}
+	if( libfcache_linear_table_allocate(
+	     number_of_slots,
+	     &( safe_linear_table->number_of_allocated_slots ),
+	     &( safe_linear_table->offsets ),
+	     &( safe_linear_table->timestamps ),
+	     &( safe_linear_table->file_indexes ),
+	     &( safe_linear_table->slot_is_set ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate arrays.",
+		 function );
+
+		goto on_error;
+	}
+	safe_linear_table->number_of_slots = number_of_slots;
+
+	*linear_table = safe_linear_table;
+
+	return( 1 );
+
+on_error:
+	if( safe_linear_table != NULL )
+	{
+		memory_free(
+		 safe_linear_table );
+	}
+	return( -1 );
+}
+
+/* Frees a linear table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_linear_table_free(
+     libfcache_linear_table_t **linear_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_linear_table_free";
+
+	if( linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid linear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *linear_table != NULL )
+	{
+		if( ( *linear_table )->slot_is_set != NULL )
+		{
+			memory_free(
+			 ( *linear_table )->slot_is_set );
+		}
+		if( ( *linear_table )->file_indexes != NULL )
+		{
+			memory_free(
+			 ( *linear_table )->file_indexes );
+		}
+		if( ( *linear_table )->timestamps != NULL )
+		{
+			memory_free(
+			 ( *linear_table )->timestamps );
+		}
+		if( ( *linear_table )->offsets != NULL )
+		{
+			memory_free(
+			 ( *linear_table )->offsets );
+		}
+		memory_free(
+		 *linear_table );
+
+		*linear_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the linear table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_linear_table_clear(
+     libfcache_linear_table_t *linear_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_linear_table_clear";
+
+	if( linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid linear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     linear_table->slot_is_set,
+	     0,
+	     sizeof( uint8_t ) * linear_table->number_of_allocated_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slot is set values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes the linear table
+ * The identifiers of the slots that remain are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_linear_table_resize(
+     libfcache_linear_table_t *linear_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	int64_t *timestamps           = NULL;
+	off64_t *offsets              = NULL;
+	static char *function         = "libfcache_linear_table_resize";
+	uint8_t *slot_is_set          = NULL;
+	int *file_indexes             = NULL;
+	int number_of_allocated_slots = 0;
+	int number_of_retained_slots  = 0;
+	int slot                      = 0;
+
+	if( linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid linear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_linear_table_allocate(
+	     number_of_slots,
+	     &number_of_allocated_slots,
+	     &offsets,
+	     &timestamps,
+	     &file_indexes,
+	     &slot_is_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to allocate arrays.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_retained_slots = linear_table->number_of_slots;
+
+	if( number_of_retained_slots > number_of_slots )
+	{
+		number_of_retained_slots = number_of_slots;
+	}
+	for( slot = 0;
+	     slot < number_of_retained_slots;
+	     slot++ )
+	{
+		offsets[ slot ]      = linear_table->offsets[ slot ];
+		timestamps[ slot ]   = linear_table->timestamps[ slot ];
+		file_indexes[ slot ] = linear_table->file_indexes[ slot ];
+		slot_is_set[ slot ]  = linear_table->slot_is_set[ slot ];
+	}
+	memory_free(
+	 linear_table->slot_is_set );
+
+	memory_free(
+	 linear_table->file_indexes );
+
+	memory_free(
+	 linear_table->timestamps );
+
+	memory_free(
+	 linear_table->offsets );
+
+	linear_table->number_of_slots           = number_of_slots;
+	linear_table->number_of_allocated_slots = number_of_allocated_slots;
+	linear_table->offsets                   = offsets;
+	linear_table->timestamps                = timestamps;
+	linear_table->file_indexes              = file_indexes;
+	linear_table->slot_is_set               = slot_is_set;
+
+	return( 1 );
+}
+
+/* Retrieves a bit mask of the offsets in a group that match a specific offset
+ * The group must contain LIBFCACHE_LINEAR_TABLE_GROUP_SIZE offsets
+ * Returns the bit mask
+ */
+uint32_t libfcache_linear_table_get_group_match_mask(
+          const off64_t *offsets,
+          off64_t offset )
+{
+#if defined( LIBFCACHE_LINEAR_TABLE_HAVE_AVX2 )
+	__m256i compare = _mm256_cmpeq_epi64(
+	                   _mm256_loadu_si256(
+	                    (const __m256i *) offsets ),
+	                   _mm256_set1_epi64x(
+	                    (long long) offset ) );
+
+	return( (uint32_t) _mm256_movemask_pd(
+	                    _mm256_castsi256_pd(
+	                     compare ) ) );
+
+#elif defined( LIBFCACHE_LINEAR_TABLE_HAVE_SSE2 )
+	__m128i compare_high = _mm_setzero_si128();
+	__m128i compare_low  = _mm_setzero_si128();
+	__m128i key          = _mm_set1_epi64x(
+	                        (long long) offset );
+
+	/* SSE2 has no 64-bit comparison, hence both 32-bit halves need to match
+	 */
+	compare_low = _mm_cmpeq_epi32(
+	               _mm_loadu_si128(
+	                (const __m128i *) offsets ),
+	               key );
+
+	compare_low = _mm_and_si128(
+	               compare_low,
+	               _mm_shuffle_epi32(
+	                compare_low,
+	                _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+	compare_high = _mm_cmpeq_epi32(
+	                _mm_loadu_si128(
+	                 (const __m128i *) &( offsets[ 2 ] ) ),
+	                key );
+
+	compare_high = _mm_and_si128(
+	                compare_high,
+	                _mm_shuffle_epi32(
+	                 compare_high,
+	                 _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+	return( (uint32_t) _mm_movemask_pd( _mm_castsi128_pd( compare_low ) )
+	     | ( (uint32_t) _mm_movemask_pd( _mm_castsi128_pd( compare_high ) ) << 2 ) );
+
+#elif defined( LIBFCACHE_LINEAR_TABLE_HAVE_NEON )
+	int64x2_t key           = vdupq_n_s64(
+	                           (int64_t) offset );
+	uint64x2_t compare_high = vceqq_s64(
+	                           vld1q_s64(
+	                            (const int64_t *) &( offsets[ 2 ] ) ),
+	                           key );
+	uint64x2_t compare_low  = vceqq_s64(
+	                           vld1q_s64(
+	                            (const int64_t *) offsets ),
+	                           key );
+
+	return( (uint32_t) ( vgetq_lane_u64( compare_low, 0 ) & 0x01 )
+	     | ( (uint32_t) ( vgetq_lane_u64( compare_low, 1 ) & 0x01 ) << 1 )
+	     | ( (uint32_t) ( vgetq_lane_u64( compare_high, 0 ) & 0x01 ) << 2 )
+	     | ( (uint32_t) ( vgetq_lane_u64( compare_high, 1 ) & 0x01 ) << 3 ) );
+#else
+	uint32_t mask    = 0;
+	int offset_index = 0;
+
+	for( offset_index = 0;
+	     offset_index < LIBFCACHE_LINEAR_TABLE_GROUP_SIZE;
+	     offset_index++ )
+	{
+		if( offsets[ offset_index ] == offset )
+		{
+			mask |= (uint32_t) 1 << offset_index;
+		}
+	}
+	return( mask );
+#endif
+}
+
+/* Retrieves the slot that matches the identifier
+ * Returns 1 if successful, 0 if no such slot or -1 on error
+ */
+int libfcache_linear_table_get_slot_by_identifier(
+     libfcache_linear_table_t *linear_table,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_linear_table_get_slot_by_identifier";
+	uint64_t match_mask   = 0;
+	int group_slot        = 0;
+	int last_group_slot   = 0;
+	int mask_slot         = 0;
+	int safe_slot         = 0;
+
+	if( linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid linear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	/* Compare the offsets a group at a time since they differ most between identifiers,
+	 * the match masks of 64 slots are combined so that the comparisons do not branch,
+	 * and only check the file index and timestamp of matching offsets
+	 */
+	for( mask_slot = 0;
+	     mask_slot < linear_table->number_of_allocated_slots;
+	     mask_slot += 64 )
+	{
+		last_group_slot = mask_slot + 64;
+
+		if( last_group_slot > linear_table->number_of_allocated_slots )
+		{
+			last_group_slot = linear_table->number_of_allocated_slots;
+		}
+		match_mask = 0;
+
+		for( group_slot = mask_slot;
+		     group_slot < last_group_slot;
+		     group_slot += LIBFCACHE_LINEAR_TABLE_GROUP_SIZE )
+		{
+			match_mask |= (uint64_t) libfcache_linear_table_get_group_match_mask(
+			                          &( linear_table->offsets[ group_slot ] ),
+			                          offset ) << ( group_slot - mask_slot );
+		}
+		while( match_mask != 0 )
+		{
+			safe_slot = mask_slot + libfcache_linear_table_get_first_bit_index(
+			                         match_mask );
+
+			if( ( linear_table->slot_is_set[ safe_slot ] != 0 )
+			 && ( linear_table->file_indexes[ safe_slot ] == file_index )
+			 && ( linear_table->timestamps[ safe_slot ] == timestamp ) )
+			{
+				*slot = safe_slot;
+
+				return( 1 );
+			}
+			match_mask &= match_mask - 1;
+		}
+	}
+	return( 0 );
+}
+
+/* Inserts a slot with a specific identifier
+ * If the slot is already stored its identifier is replaced
+ * If another slot is stored with the same identifier it is replaced,
+ * so that the most recently stored identifier is found
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_linear_table_insert_slot(
+     libfcache_linear_table_t *linear_table,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_linear_table_insert_slot";
+	int existing_slot     = 0;
+	int result            = 0;
+
+	if( linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid linear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= linear_table->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &existing_slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		linear_table->slot_is_set[ existing_slot ] = 0;
+	}
+	linear_table->offsets[ slot ]      = offset;
+	linear_table->timestamps[ slot ]   = timestamp;
+	linear_table->file_indexes[ slot ] = file_index;
+	linear_table->slot_is_set[ slot ]  = 1;
+
+	return( 1 );
+}
+
+/* Removes a slot
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_linear_table_remove_slot(
+     libfcache_linear_table_t *linear_table,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_linear_table_remove_slot";
+
+	if( linear_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid linear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= linear_table->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	linear_table->slot_is_set[ slot ] = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,120 @@
+/*
+ * Linear table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_LINEAR_TABLE_H )
+#define _LIBFCACHE_LINEAR_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_linear_table libfcache_linear_table_t;
+
+struct libfcache_linear_table
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The number of allocated slots, a multiple of the group size
+	 */
+	int number_of_allocated_slots;
+
+	/* The offsets, one per allocated slot
+	 */
+	off64_t *offsets;
+
+	/* The timestamps, one per allocated slot
+	 */
+	int64_t *timestamps;
+
+	/* The file indexes, one per allocated slot
+	 */
+	int *file_indexes;
+
+	/* Values to indicate the slots are stored, one per allocated slot
+	 */
+	uint8_t *slot_is_set;
+};
+
+int libfcache_linear_table_allocate(
+     int number_of_slots,
+     int *number_of_allocated_slots,
+     off64_t **offsets,
+     int64_t **timestamps,
+     int **file_indexes,
+     uint8_t **slot_is_set,
+     libcerror_error_t **error );
+
+int libfcache_linear_table_initialize(
+     libfcache_linear_table_t **linear_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_linear_table_free(
+     libfcache_linear_table_t **linear_table,
+     libcerror_error_t **error );
+
+int libfcache_linear_table_clear(
+     libfcache_linear_table_t *linear_table,
+     libcerror_error_t **error );
+
+int libfcache_linear_table_resize(
+     libfcache_linear_table_t *linear_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+uint32_t libfcache_linear_table_get_group_match_mask(
+          const off64_t *offsets,
+          off64_t offset );
+
+int libfcache_linear_table_get_slot_by_identifier(
+     libfcache_linear_table_t *linear_table,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     int *slot,
+     libcerror_error_t **error );
+
+int libfcache_linear_table_insert_slot(
+     libfcache_linear_table_t *linear_table,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_linear_table_remove_slot(
+     libfcache_linear_table_t *linear_table,
+     int slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_LINEAR_TABLE_H ) */
+
@@ -0,0 +1,684 @@
+/*
+ * The pending loads functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+#include "libfcache_libcthreads.h"
+#include "libfcache_pending_loads.h"
+#include "libfcache_types.h"
+
+/* Creates a pending load
+ * Make sure the value pending_load is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_pending_load_initialize(
+     libfcache_pending_load_t **pending_load,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	libfcache_pending_load_t *safe_pending_load = NULL;
+	static char *function                       = "libfcache_pending_load_initialize";
+
+	if( pending_load == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending load.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pending_load != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pending load value already set.",
+		 function );
+
+		return( -1 );
+	}
+	safe_pending_load = memory_allocate_structure(
+	                     libfcache_pending_load_t );
+
+	if( safe_pending_load == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pending load.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_pending_load,
+	     0,
+	     sizeof( libfcache_pending_load_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pending load.",
+		 function );
+
+		memory_free(
+		 safe_pending_load );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_initialize(
+	     &( safe_pending_load->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	safe_pending_load->file_index = file_index;
+	safe_pending_load->offset     = offset;
+	safe_pending_load->timestamp  = timestamp;
+
+	*pending_load = safe_pending_load;
+
+	return( 1 );
+
+on_error:
+	if( safe_pending_load != NULL )
+	{
+		memory_free(
+		 safe_pending_load );
+	}
+	return( -1 );
+}
+
+/* Frees a pending load
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_pending_load_free(
+     libfcache_pending_load_t **pending_load,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_pending_load_free";
+	int result            = 1;
+
+	if( pending_load == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending load.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pending_load != NULL )
+	{
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *pending_load )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *pending_load );
+
+		*pending_load = NULL;
+	}
+	return( result );
+}
+
+/* Creates pending loads
+ * Make sure the value pending_loads is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_pending_loads_initialize(
+     libfcache_pending_loads_t **pending_loads,
+     libcerror_error_t **error )
+{
+	libfcache_pending_loads_t *safe_pending_loads = NULL;
+	static char *function                         = "libfcache_pending_loads_initialize";
+
+	if( pending_loads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending loads.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pending_loads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pending loads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	safe_pending_loads = memory_allocate_structure(
+	                      libfcache_pending_loads_t );
+
+	if( safe_pending_loads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pending loads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_pending_loads,
+	     0,
+	     sizeof( libfcache_pending_loads_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pending loads.",
+		 function );
+
+		memory_free(
+		 safe_pending_loads );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( safe_pending_loads->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*pending_loads = safe_pending_loads;
+
+	return( 1 );
+
+on_error:
+	if( safe_pending_loads != NULL )
+	{
+		memory_free(
+		 safe_pending_loads );
+	}
+	return( -1 );
+}
+
+/* Frees pending loads
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_pending_loads_free(
+     libfcache_pending_loads_t **pending_loads,
+     libcerror_error_t **error )
+{
+	libfcache_pending_load_t *pending_load = NULL;
+	static char *function                  = "libfcache_pending_loads_free";
+	int result                             = 1;
+
+	if( pending_loads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending loads.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pending_loads != NULL )
+	{
+		while( ( *pending_loads )->first_load != NULL )
+		{
+			pending_load = ( *pending_loads )->first_load;
+
+			( *pending_loads )->first_load = pending_load->next_load;
+
+			if( libfcache_pending_load_free(
+			     &pending_load,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pending load.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *pending_loads )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *pending_loads );
+
+		*pending_loads = NULL;
+	}
+	return( result );
+}
+
+/* Starts the load of the value with a specific identifier
+ * If another thread is loading the same value, the function waits
+ * for that load to finish and retrieves the cache value it loaded
+ * The pending loads are only used by the cache with multi-thread support
+ * Returns 1 if the caller should load the value and finish the pending load,
+ * 0 if the value was loaded by another thread or -1 on error
+ */
+int libfcache_pending_loads_start_load(
+     libfcache_pending_loads_t *pending_loads,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_pending_load_t **pending_load,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_pending_load_t *safe_pending_load = NULL;
+	static char *function                       = "libfcache_pending_loads_start_load";
+	int result                                  = 1;
+
+	if( pending_loads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending loads.",
+		 function );
+
+		return( -1 );
+	}
+	if( pending_load == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending load.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	*pending_load = NULL;
+	*cache_value  = NULL;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     pending_loads->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_pending_load = pending_loads->first_load;
+
+	while( safe_pending_load != NULL )
+	{
+		if( ( safe_pending_load->offset == offset )
+		 && ( safe_pending_load->file_index == file_index )
+		 && ( safe_pending_load->timestamp == timestamp ) )
+		{
+			break;
+		}
+		safe_pending_load = safe_pending_load->next_load;
+	}
+	if( safe_pending_load == NULL )
+	{
+		if( libfcache_pending_load_initialize(
+		     &safe_pending_load,
+		     file_index,
+		     offset,
+		     timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create pending load.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			safe_pending_load->next_load = pending_loads->first_load;
+			pending_loads->first_load    = safe_pending_load;
+
+			pending_loads->number_of_loads += 1;
+
+			*pending_load = safe_pending_load;
+		}
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	else
+	{
+		safe_pending_load->number_of_waiters += 1;
+
+		while( safe_pending_load->result == 0 )
+		{
+			if( libcthreads_condition_wait(
+			     safe_pending_load->condition,
+			     pending_loads->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		safe_pending_load->number_of_waiters -= 1;
+
+		if( result != -1 )
+		{
+			if( safe_pending_load->result == 1 )
+			{
+				*cache_value = safe_pending_load->cache_value;
+
+				result = 0;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to load value in other thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The finished load was removed from the pending loads
+		 * and is freed by the last thread that waited for it
+		 */
+		if( ( safe_pending_load->result != 0 )
+		 && ( safe_pending_load->number_of_waiters == 0 ) )
+		{
+			if( libfcache_pending_load_free(
+			     &safe_pending_load,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pending load.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( libcthreads_mutex_release(
+	     pending_loads->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Finishes a pending load and wakes the threads that wait for it
+ * The load result is 1 if the value was loaded or -1 if the load failed
+ * The pending load is freed, either by this function or by the last thread
+ * that waited for it, and should no longer be used by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_pending_loads_finish_load(
+     libfcache_pending_loads_t *pending_loads,
+     libfcache_pending_load_t *pending_load,
+     libfcache_cache_value_t *cache_value,
+     int load_result,
+     libcerror_error_t **error )
+{
+	libfcache_pending_load_t *previous_load = NULL;
+	libfcache_pending_load_t *safe_load     = NULL;
+	static char *function                   = "libfcache_pending_loads_finish_load";
+	int result                              = 1;
+
+	if( pending_loads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending loads.",
+		 function );
+
+		return( -1 );
+	}
+	if( pending_load == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pending load.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( load_result != 1 )
+	 && ( load_result != -1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported load result.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     pending_loads->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_load = pending_loads->first_load;
+
+	while( ( safe_load != NULL )
+	    && ( safe_load != pending_load ) )
+	{
+		previous_load = safe_load;
+		safe_load     = safe_load->next_load;
+	}
+	if( safe_load == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing pending load.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( previous_load == NULL )
+		{
+			pending_loads->first_load = safe_load->next_load;
+		}
+		else
+		{
+			previous_load->next_load = safe_load->next_load;
+		}
+		pending_loads->number_of_loads -= 1;
+
+		safe_load->next_load = NULL;
+		safe_load->result    = load_result;
+
+		if( load_result == 1 )
+		{
+			safe_load->cache_value = cache_value;
+		}
+		if( safe_load->number_of_waiters == 0 )
+		{
+			if( libfcache_pending_load_free(
+			     &safe_load,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pending load.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+		else if( libcthreads_condition_broadcast(
+		          safe_load->condition,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+	}
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     pending_loads->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * The pending loads functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_PENDING_LOADS_H )
+#define _LIBFCACHE_PENDING_LOADS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+#include "libfcache_libcthreads.h"
+#include "libfcache_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_pending_load libfcache_pending_load_t;
+
+struct libfcache_pending_load
+{
+	/* The file index
+	 */
+	int file_index;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The timestamp
+	 */
+	int64_t timestamp;
+
+	/* The cache value that was loaded, contains NULL if not set
+	 */
+	libfcache_cache_value_t *cache_value;
+
+	/* The result of the load, 1 if the value was loaded, -1 if the load failed
+	 * or 0 if the value is still being loaded
+	 */
+	int result;
+
+	/* The number of threads that wait for the load to finish
+	 */
+	int number_of_waiters;
+
+	/* The next pending load
+	 */
+	libfcache_pending_load_t *next_load;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* The condition that is signalled when the load finishes
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+typedef struct libfcache_pending_loads libfcache_pending_loads_t;
+
+struct libfcache_pending_loads
+{
+	/* The first pending load
+	 */
+	libfcache_pending_load_t *first_load;
+
+	/* The number of pending loads
+	 */
+	int number_of_loads;
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfcache_pending_load_initialize(
+     libfcache_pending_load_t **pending_load,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_pending_load_free(
+     libfcache_pending_load_t **pending_load,
+     libcerror_error_t **error );
+
+int libfcache_pending_loads_initialize(
+     libfcache_pending_loads_t **pending_loads,
+     libcerror_error_t **error );
+
+int libfcache_pending_loads_free(
+     libfcache_pending_loads_t **pending_loads,
+     libcerror_error_t **error );
+
+int libfcache_pending_loads_start_load(
+     libfcache_pending_loads_t *pending_loads,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_pending_load_t **pending_load,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+int libfcache_pending_loads_finish_load(
+     libfcache_pending_loads_t *pending_loads,
+     libfcache_pending_load_t *pending_load,
+     libfcache_cache_value_t *cache_value,
+     int load_result,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_PENDING_LOADS_H ) */
+
@@ -0,0 +1,942 @@
+/*
+ * Replacement policy functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_clock.h"
+#include "libfcache_greedy_dual.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_policy.h"
+#include "libfcache_s3_fifo.h"
+#include "libfcache_two_queue.h"
+#include "libfcache_unused.h"
+
+/* Inserts a slot in a clock policy
+ * Returns 1 if successful or -1 on error
+ */
+static int libfcache_policy_clock_insert_slot(
+            intptr_t *policy_data,
+            int slot,
+            int file_index LIBFCACHE_ATTRIBUTE_UNUSED,
+            off64_t offset LIBFCACHE_ATTRIBUTE_UNUSED,
+            int64_t timestamp LIBFCACHE_ATTRIBUTE_UNUSED,
+            libcerror_error_t **error )
+{
+	LIBFCACHE_UNREFERENCED_PARAMETER( file_index )
+	LIBFCACHE_UNREFERENCED_PARAMETER( offset )
+	LIBFCACHE_UNREFERENCED_PARAMETER( timestamp )
+
+	return( libfcache_clock_insert_slot(
+	         (libfcache_clock_t *) policy_data,
+	         slot,
+	         error ) );
+}
+
+/* Removes a slot from a clock policy
+ * Returns 1 if successful or -1 on error
+ */
+static int libfcache_policy_clock_remove_slot(
+            intptr_t *policy_data,
+            int slot,
+            int file_index LIBFCACHE_ATTRIBUTE_UNUSED,
+            off64_t offset LIBFCACHE_ATTRIBUTE_UNUSED,
+            int64_t timestamp LIBFCACHE_ATTRIBUTE_UNUSED,
+            libcerror_error_t **error )
+{
+	LIBFCACHE_UNREFERENCED_PARAMETER( file_index )
+	LIBFCACHE_UNREFERENCED_PARAMETER( offset )
+	LIBFCACHE_UNREFERENCED_PARAMETER( timestamp )
+
+	return( libfcache_clock_remove_slot(
+	         (libfcache_clock_t *) policy_data,
+	         slot,
+	         error ) );
+}
+
+/* Inserts a slot in a GreedyDual-Size-Frequency policy
+ * Returns 1 if successful or -1 on error
+ */
+static int libfcache_policy_greedy_dual_insert_slot(
+            intptr_t *policy_data,
+            int slot,
+            int file_index LIBFCACHE_ATTRIBUTE_UNUSED,
+            off64_t offset LIBFCACHE_ATTRIBUTE_UNUSED,
+            int64_t timestamp LIBFCACHE_ATTRIBUTE_UNUSED,
+            libcerror_error_t **error )
+{
+	LIBFCACHE_UNREFERENCED_PARAMETER( file_index )
+	LIBFCACHE_UNREFERENCED_PARAMETER( offset )
+	LIBFCACHE_UNREFERENCED_PARAMETER( timestamp )
+
+	return( libfcache_greedy_dual_insert_slot(
+	         (libfcache_greedy_dual_t *) policy_data,
+	         slot,
+	         error ) );
+}
+
+/* Removes a slot from a GreedyDual-Size-Frequency policy
+ * Returns 1 if successful or -1 on error
+ */
+static int libfcache_policy_greedy_dual_remove_slot(
+            intptr_t *policy_data,
+            int slot,
+            int file_index LIBFCACHE_ATTRIBUTE_UNUSED,
+            off64_t offset LIBFCACHE_ATTRIBUTE_UNUSED,
+            int64_t timestamp LIBFCACHE_ATTRIBUTE_UNUSED,
+            libcerror_error_t **error )
+{
+	LIBFCACHE_UNREFERENCED_PARAMETER( file_index )
+	LIBFCACHE_UNREFERENCED_PARAMETER( offset )
+	LIBFCACHE_UNREFERENCED_PARAMETER( timestamp )
+
+	return( libfcache_greedy_dual_remove_slot(
+	         (libfcache_greedy_dual_t *) policy_data,
+	         slot,
+	         error ) );
+}
+
+/* Creates a policy
+ * Make sure the value policy is referencing, is set to NULL
+ * The policy takes over management of the policy data if free_policy_data is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_initialize(
+     libfcache_policy_t **policy,
+     intptr_t *policy_data,
+     int (*free_policy_data)(
+            intptr_t **policy_data,
+            libcerror_error_t **error ),
+     int (*clone_policy_data)(
+            intptr_t **destination_policy_data,
+            intptr_t *source_policy_data,
+            libcerror_error_t **error ),
+     int (*clear_policy_data)(
+            intptr_t *policy_data,
+            libcerror_error_t **error ),
+     int (*resize_policy_data)(
+            intptr_t *policy_data,
+            int number_of_slots,
+            libcerror_error_t **error ),
+     int (*insert_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*reference_slot)(
+            intptr_t *policy_data,
+            int slot,
+            libcerror_error_t **error ),
+     int (*remove_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*get_victim_slot)(
+            intptr_t *policy_data,
+            int *slot,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libfcache_policy_t *safe_policy = NULL;
+	static char *function           = "libfcache_policy_initialize";
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *policy != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid policy value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( clear_policy_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clear policy data function.",
+		 function );
+
+		return( -1 );
+	}
+	if( resize_policy_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resize policy data function.",
+		 function );
+
+		return( -1 );
+	}
+	if( insert_slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid insert slot function.",
+		 function );
+
+		return( -1 );
+	}
+	if( reference_slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reference slot function.",
+		 function );
+
+		return( -1 );
+	}
+	if( remove_slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid remove slot function.",
+		 function );
+
+		return( -1 );
+	}
+	if( get_victim_slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get victim slot function.",
+		 function );
+
+		return( -1 );
+	}
+	safe_policy = memory_allocate_structure(
+	               libfcache_policy_t );
+
+	if( safe_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     safe_policy,
+	     0,
+	     sizeof( libfcache_policy_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear policy.",
+		 function );
+
+		memory_free(
+		 safe_policy );
+
+		return( -1 );
+	}
+	safe_policy->policy_data        = policy_data;
+	safe_policy->free_policy_data   = free_policy_data;
+	safe_policy->clone_policy_data  = clone_policy_data;
+	safe_policy->clear_policy_data  = clear_policy_data;
+	safe_policy->resize_policy_data = resize_policy_data;
+	safe_policy->insert_slot        = insert_slot;
+	safe_policy->reference_slot     = reference_slot;
+	safe_policy->remove_slot        = remove_slot;
+	safe_policy->get_victim_slot    = get_victim_slot;
+
+	*policy = safe_policy;
+
+	return( 1 );
+}
+
+/* Creates a CLOCK policy
+ * Make sure the value policy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_initialize_clock(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_clock_t *cache_clock = NULL;
+	static char *function          = "libfcache_policy_initialize_clock";
+
+	if( libfcache_clock_initialize(
+	     &cache_clock,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create clock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_policy_initialize(
+	     policy,
+	     (intptr_t *) cache_clock,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_clock_free,
+	     NULL,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfcache_clock_clear,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_clock_resize,
+	     &libfcache_policy_clock_insert_slot,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_clock_reference_slot,
+	     &libfcache_policy_clock_remove_slot,
+	     (int (*)(intptr_t *, int *, libcerror_error_t **)) &libfcache_clock_get_victim_slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create policy.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( cache_clock != NULL )
+	{
+		libfcache_clock_free(
+		 &cache_clock,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a 2Q policy
+ * Make sure the value policy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_initialize_two_queue(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_two_queue_t *two_queue = NULL;
+	static char *function            = "libfcache_policy_initialize_two_queue";
+
+	if( libfcache_two_queue_initialize(
+	     &two_queue,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create 2Q.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_policy_initialize(
+	     policy,
+	     (intptr_t *) two_queue,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_two_queue_free,
+	     NULL,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfcache_two_queue_clear,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_two_queue_resize,
+	     (int (*)(intptr_t *, int, int, off64_t, int64_t, libcerror_error_t **)) &libfcache_two_queue_insert_slot,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_two_queue_reference_slot,
+	     (int (*)(intptr_t *, int, int, off64_t, int64_t, libcerror_error_t **)) &libfcache_two_queue_evict_slot,
+	     (int (*)(intptr_t *, int *, libcerror_error_t **)) &libfcache_two_queue_get_victim_slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create policy.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( two_queue != NULL )
+	{
+		libfcache_two_queue_free(
+		 &two_queue,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a S3-FIFO policy
+ * Make sure the value policy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_initialize_s3_fifo(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_s3_fifo_t *s3_fifo = NULL;
+	static char *function        = "libfcache_policy_initialize_s3_fifo";
+
+	if( libfcache_s3_fifo_initialize(
+	     &s3_fifo,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create S3-FIFO.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_policy_initialize(
+	     policy,
+	     (intptr_t *) s3_fifo,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_s3_fifo_free,
+	     NULL,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfcache_s3_fifo_clear,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_s3_fifo_resize,
+	     (int (*)(intptr_t *, int, int, off64_t, int64_t, libcerror_error_t **)) &libfcache_s3_fifo_insert_slot,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_s3_fifo_reference_slot,
+	     (int (*)(intptr_t *, int, int, off64_t, int64_t, libcerror_error_t **)) &libfcache_s3_fifo_evict_slot,
+	     (int (*)(intptr_t *, int *, libcerror_error_t **)) &libfcache_s3_fifo_get_victim_slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create policy.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( s3_fifo != NULL )
+	{
+		libfcache_s3_fifo_free(
+		 &s3_fifo,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a GreedyDual-Size-Frequency policy
+ * Make sure the value policy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_initialize_greedy_dual(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_greedy_dual_t *greedy_dual = NULL;
+	static char *function                = "libfcache_policy_initialize_greedy_dual";
+
+	if( libfcache_greedy_dual_initialize(
+	     &greedy_dual,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GreedyDual-Size-Frequency.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_policy_initialize(
+	     policy,
+	     (intptr_t *) greedy_dual,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_greedy_dual_free,
+	     NULL,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfcache_greedy_dual_clear,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_greedy_dual_resize,
+	     &libfcache_policy_greedy_dual_insert_slot,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfcache_greedy_dual_reference_slot,
+	     &libfcache_policy_greedy_dual_remove_slot,
+	     (int (*)(intptr_t *, int *, libcerror_error_t **)) &libfcache_greedy_dual_get_victim_slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create policy.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( greedy_dual != NULL )
+	{
+		libfcache_greedy_dual_free(
+		 &greedy_dual,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a policy
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_free(
+     libfcache_policy_t **policy,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_policy_free";
+	int result            = 1;
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *policy != NULL )
+	{
+		if( ( ( *policy )->free_policy_data != NULL )
+		 && ( ( *policy )->policy_data != NULL ) )
+		{
+			if( ( *policy )->free_policy_data(
+			     &( ( *policy )->policy_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free policy data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *policy );
+
+		*policy = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the policy
+ * The policy data of the destination is cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_clone(
+     libfcache_policy_t **destination_policy,
+     libfcache_policy_t *source_policy,
+     libcerror_error_t **error )
+{
+	intptr_t *destination_policy_data = NULL;
+	static char *function             = "libfcache_policy_clone";
+
+	if( destination_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_policy != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination policy value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_policy == NULL )
+	{
+		*destination_policy = NULL;
+
+		return( 1 );
+	}
+	if( source_policy->clone_policy_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source policy - missing clone policy data function.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_policy->clone_policy_data(
+	     &destination_policy_data,
+	     source_policy->policy_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to clone policy data.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_policy->clear_policy_data(
+	     destination_policy_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear destination policy data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_policy_initialize(
+	     destination_policy,
+	     destination_policy_data,
+	     source_policy->free_policy_data,
+	     source_policy->clone_policy_data,
+	     source_policy->clear_policy_data,
+	     source_policy->resize_policy_data,
+	     source_policy->insert_slot,
+	     source_policy->reference_slot,
+	     source_policy->remove_slot,
+	     source_policy->get_victim_slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination policy.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( destination_policy_data != NULL )
+	 && ( source_policy->free_policy_data != NULL ) )
+	{
+		source_policy->free_policy_data(
+		 &destination_policy_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Clears the policy
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_clear(
+     libfcache_policy_t *policy,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_policy_clear";
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( policy->clear_policy_data(
+	     policy->policy_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear policy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes the policy
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_resize(
+     libfcache_policy_t *policy,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_policy_resize";
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( policy->resize_policy_data(
+	     policy->policy_data,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize policy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a slot
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_insert_slot(
+     libfcache_policy_t *policy,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_policy_insert_slot";
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( policy->insert_slot(
+	     policy->policy_data,
+	     slot,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert slot: %d.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Marks a slot as referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_reference_slot(
+     libfcache_policy_t *policy,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_policy_reference_slot";
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( policy->reference_slot(
+	     policy->policy_data,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reference slot: %d.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a slot
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_remove_slot(
+     libfcache_policy_t *policy,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_policy_remove_slot";
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( policy->remove_slot(
+	     policy->policy_data,
+	     slot,
+	     file_index,
+	     offset,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove slot: %d.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the slot to reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_policy_get_victim_slot(
+     libfcache_policy_t *policy,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_policy_get_victim_slot";
+
+	if( policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( policy->get_victim_slot(
+	     policy->policy_data,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve victim slot.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
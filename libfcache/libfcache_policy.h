@@ -0,0 +1,213 @@
+/*
+ * Replacement policy functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_POLICY_H )
+#define _LIBFCACHE_POLICY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_policy libfcache_policy_t;
+
+struct libfcache_policy
+{
+	/* The policy data
+	 */
+	intptr_t *policy_data;
+
+	/* The free policy data function
+	 */
+	int (*free_policy_data)(
+	       intptr_t **policy_data,
+	       libcerror_error_t **error );
+
+	/* The clone (duplicate) policy data function
+	 */
+	int (*clone_policy_data)(
+	       intptr_t **destination_policy_data,
+	       intptr_t *source_policy_data,
+	       libcerror_error_t **error );
+
+	/* The clear policy data function
+	 */
+	int (*clear_policy_data)(
+	       intptr_t *policy_data,
+	       libcerror_error_t **error );
+
+	/* The resize policy data function
+	 */
+	int (*resize_policy_data)(
+	       intptr_t *policy_data,
+	       int number_of_slots,
+	       libcerror_error_t **error );
+
+	/* The insert slot function, called when a value is set in a slot
+	 */
+	int (*insert_slot)(
+	       intptr_t *policy_data,
+	       int slot,
+	       int file_index,
+	       off64_t offset,
+	       int64_t timestamp,
+	       libcerror_error_t **error );
+
+	/* The reference slot function, called when the value of a slot is retrieved
+	 */
+	int (*reference_slot)(
+	       intptr_t *policy_data,
+	       int slot,
+	       libcerror_error_t **error );
+
+	/* The remove slot function, called when the value of a slot is cleared or replaced
+	 */
+	int (*remove_slot)(
+	       intptr_t *policy_data,
+	       int slot,
+	       int file_index,
+	       off64_t offset,
+	       int64_t timestamp,
+	       libcerror_error_t **error );
+
+	/* The get victim slot function, called to retrieve the slot to reuse
+	 */
+	int (*get_victim_slot)(
+	       intptr_t *policy_data,
+	       int *slot,
+	       libcerror_error_t **error );
+};
+
+int libfcache_policy_initialize(
+     libfcache_policy_t **policy,
+     intptr_t *policy_data,
+     int (*free_policy_data)(
+            intptr_t **policy_data,
+            libcerror_error_t **error ),
+     int (*clone_policy_data)(
+            intptr_t **destination_policy_data,
+            intptr_t *source_policy_data,
+            libcerror_error_t **error ),
+     int (*clear_policy_data)(
+            intptr_t *policy_data,
+            libcerror_error_t **error ),
+     int (*resize_policy_data)(
+            intptr_t *policy_data,
+            int number_of_slots,
+            libcerror_error_t **error ),
+     int (*insert_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*reference_slot)(
+            intptr_t *policy_data,
+            int slot,
+            libcerror_error_t **error ),
+     int (*remove_slot)(
+            intptr_t *policy_data,
+            int slot,
+            int file_index,
+            off64_t offset,
+            int64_t timestamp,
+            libcerror_error_t **error ),
+     int (*get_victim_slot)(
+            intptr_t *policy_data,
+            int *slot,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libfcache_policy_initialize_clock(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_policy_initialize_two_queue(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_policy_initialize_s3_fifo(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_policy_initialize_greedy_dual(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_policy_free(
+     libfcache_policy_t **policy,
+     libcerror_error_t **error );
+
+int libfcache_policy_clone(
+     libfcache_policy_t **destination_policy,
+     libfcache_policy_t *source_policy,
+     libcerror_error_t **error );
+
+int libfcache_policy_clear(
+     libfcache_policy_t *policy,
+     libcerror_error_t **error );
+
+int libfcache_policy_resize(
+     libfcache_policy_t *policy,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_policy_insert_slot(
+     libfcache_policy_t *policy,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_policy_reference_slot(
+     libfcache_policy_t *policy,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_policy_remove_slot(
+     libfcache_policy_t *policy,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_policy_get_victim_slot(
+     libfcache_policy_t *policy,
+     int *slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_POLICY_H ) */
+
@@ -0,0 +1,855 @@
+/*
+ * S3-FIFO replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_slot_queues.h"
+#include "libfcache_s3_fifo.h"
+
+
+/* Sets the queue sizes for a specific number of slots
+ * The small queue holds about 10% of the slots and the ghost table remembers
+ * about 90% of the slots, which are the values suggested for S3-FIFO
+ */
+static void libfcache_s3_fifo_set_sizes(
+             libfcache_s3_fifo_t *s3_fifo,
+             int number_of_slots )
+{
+	s3_fifo->number_of_slots          = number_of_slots;
+	s3_fifo->maximum_small_queue_size = number_of_slots / 10;
+	s3_fifo->number_of_ghost_slots    = number_of_slots - s3_fifo->maximum_small_queue_size;
+
+	if( s3_fifo->maximum_small_queue_size == 0 )
+	{
+		s3_fifo->maximum_small_queue_size = 1;
+	}
+	if( s3_fifo->number_of_ghost_slots == 0 )
+	{
+		s3_fifo->number_of_ghost_slots = 1;
+	}
+	if( s3_fifo->ghost_slot >= s3_fifo->number_of_ghost_slots )
+	{
+		s3_fifo->ghost_slot = 0;
+	}
+}
+
+/* Creates a S3-FIFO
+ * Make sure the value s3_fifo is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_initialize(
+     libfcache_s3_fifo_t **s3_fifo,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_s3_fifo_t *safe_s3_fifo = NULL;
+	static char *function             = "libfcache_s3_fifo_initialize";
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( *s3_fifo != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid S3-FIFO value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_s3_fifo = memory_allocate_structure(
+	                  libfcache_s3_fifo_t );
+
+	if( safe_s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create S3-FIFO.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_s3_fifo,
+	     0,
+	     sizeof( libfcache_s3_fifo_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear S3-FIFO.",
+		 function );
+
+		memory_free(
+		 safe_s3_fifo );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_initialize(
+	     &( safe_s3_fifo->slot_queues ),
+	     number_of_slots,
+	     LIBFCACHE_S3_FIFO_NUMBER_OF_QUEUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create slot queues.",
+		 function );
+
+		goto on_error;
+	}
+	safe_s3_fifo->frequencies = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * number_of_slots );
+
+	if( safe_s3_fifo->frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create frequencies.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_s3_fifo->frequencies,
+	     0,
+	     sizeof( uint8_t ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frequencies.",
+		 function );
+
+		goto on_error;
+	}
+	libfcache_s3_fifo_set_sizes(
+	 safe_s3_fifo,
+	 number_of_slots );
+
+	if( libfcache_hash_table_initialize(
+	     &( safe_s3_fifo->ghost_table ),
+	     safe_s3_fifo->number_of_ghost_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create ghost table.",
+		 function );
+
+		goto on_error;
+	}
+	*s3_fifo = safe_s3_fifo;
+
+	return( 1 );
+
+on_error:
+	if( safe_s3_fifo != NULL )
+	{
+		if( safe_s3_fifo->frequencies != NULL )
+		{
+			memory_free(
+			 safe_s3_fifo->frequencies );
+		}
+		if( safe_s3_fifo->slot_queues != NULL )
+		{
+			libfcache_slot_queues_free(
+			 &( safe_s3_fifo->slot_queues ),
+			 NULL );
+		}
+		memory_free(
+		 safe_s3_fifo );
+	}
+	return( -1 );
+}
+
+/* Frees a S3-FIFO
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_free(
+     libfcache_s3_fifo_t **s3_fifo,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_s3_fifo_free";
+	int result            = 1;
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( *s3_fifo != NULL )
+	{
+		if( libfcache_hash_table_free(
+		     &( ( *s3_fifo )->ghost_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free ghost table.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_slot_queues_free(
+		     &( ( *s3_fifo )->slot_queues ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free slot queues.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *s3_fifo )->frequencies != NULL )
+		{
+			memory_free(
+			 ( *s3_fifo )->frequencies );
+		}
+		memory_free(
+		 *s3_fifo );
+
+		*s3_fifo = NULL;
+	}
+	return( result );
+}
+
+/* Clears the S3-FIFO
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_clear(
+     libfcache_s3_fifo_t *s3_fifo,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_s3_fifo_clear";
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_hash_table_clear(
+	     s3_fifo->ghost_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear ghost table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_clear(
+	     s3_fifo->slot_queues,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     s3_fifo->frequencies,
+	     0,
+	     sizeof( uint8_t ) * s3_fifo->number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	s3_fifo->ghost_slot = 0;
+
+	return( 1 );
+}
+
+/* Resizes the S3-FIFO
+ * The slots that remain retain their position in the queues
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_resize(
+     libfcache_s3_fifo_t *s3_fifo,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_s3_fifo_resize";
+	void *reallocation    = NULL;
+	int slot              = 0;
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_resize(
+	     s3_fifo->slot_queues,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                s3_fifo->frequencies,
+	                sizeof( uint8_t ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	s3_fifo->frequencies = (uint8_t *) reallocation;
+
+	for( slot = s3_fifo->number_of_slots;
+	     slot < number_of_slots;
+	     slot++ )
+	{
+		s3_fifo->frequencies[ slot ] = 0;
+	}
+	libfcache_s3_fifo_set_sizes(
+	 s3_fifo,
+	 number_of_slots );
+
+	if( libfcache_hash_table_resize(
+	     s3_fifo->ghost_table,
+	     s3_fifo->number_of_ghost_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize ghost table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a slot
+ * The slot is inserted in the main queue if its identifier was recently
+ * evicted from the small queue, otherwise in the small queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_insert_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_s3_fifo_insert_slot";
+	uint8_t queue_type    = LIBFCACHE_S3_FIFO_QUEUE_SMALL;
+	int ghost_slot        = 0;
+	int result            = 0;
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= s3_fifo->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_hash_table_get_slot_by_identifier(
+	          s3_fifo->ghost_table,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &ghost_slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ghost slot.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_hash_table_remove_slot(
+		     s3_fifo->ghost_table,
+		     ghost_slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove ghost slot: %d.",
+			 function,
+			 ghost_slot );
+
+			return( -1 );
+		}
+		queue_type = LIBFCACHE_S3_FIFO_QUEUE_MAIN;
+	}
+	s3_fifo->frequencies[ slot ] = 0;
+
+	if( libfcache_slot_queues_prepend_slot(
+	     s3_fifo->slot_queues,
+	     queue_type,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to prepend slot: %d to queue: %" PRIu8 ".",
+		 function,
+		 slot,
+		 queue_type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Marks a slot as referenced
+ * The slot is not moved, only its frequency is increased
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_reference_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_s3_fifo_reference_slot";
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= s3_fifo->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( s3_fifo->frequencies[ slot ] < LIBFCACHE_S3_FIFO_MAXIMUM_FREQUENCY )
+	{
+		s3_fifo->frequencies[ slot ] += 1;
+	}
+	return( 1 );
+}
+
+/* Removes a slot
+ * The slot is moved to the free queue so that it is reused first
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_remove_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_s3_fifo_remove_slot";
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= s3_fifo->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_prepend_slot(
+	     s3_fifo->slot_queues,
+	     LIBFCACHE_S3_FIFO_QUEUE_FREE,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to prepend slot: %d to free queue.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Evicts a slot
+ * The identifier of a slot evicted from the small queue is remembered in the ghost table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_evict_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_s3_fifo_evict_slot";
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= s3_fifo->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( s3_fifo->slot_queues->queue_numbers[ slot ] == LIBFCACHE_S3_FIFO_QUEUE_SMALL )
+	{
+		/* The ghost slots are reused in FIFO order, insert replaces
+		 * the identifier previously stored in the ghost slot
+		 */
+		if( libfcache_hash_table_insert_slot(
+		     s3_fifo->ghost_table,
+		     s3_fifo->ghost_slot,
+		     file_index,
+		     offset,
+		     timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert ghost slot: %d.",
+			 function,
+			 s3_fifo->ghost_slot );
+
+			return( -1 );
+		}
+		s3_fifo->ghost_slot += 1;
+
+		if( s3_fifo->ghost_slot >= s3_fifo->number_of_ghost_slots )
+		{
+			s3_fifo->ghost_slot = 0;
+		}
+	}
+	if( libfcache_slot_queues_remove_slot(
+	     s3_fifo->slot_queues,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove slot: %d from queue.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the slot to reuse
+ * A free slot is reused first, otherwise the oldest slot of the small queue
+ * if it reached its maximum size, otherwise the oldest slot of the main queue
+ * An oldest slot of the small queue that was referenced again is moved to
+ * the main queue and an oldest slot of the main queue that was referenced
+ * is reinserted in the main queue with a decreased frequency
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_s3_fifo_get_victim_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int *slot,
+     libcerror_error_t **error )
+{
+	libfcache_slot_queues_t *slot_queues = NULL;
+	static char *function                = "libfcache_s3_fifo_get_victim_slot";
+	uint8_t queue_number                 = 0;
+	int last_slot                        = 0;
+	int safe_slot                        = -1;
+
+	if( s3_fifo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid S3-FIFO.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	slot_queues = s3_fifo->slot_queues;
+
+	if( slot_queues->last_slots[ LIBFCACHE_S3_FIFO_QUEUE_FREE - 1 ] != -1 )
+	{
+		safe_slot = slot_queues->last_slots[ LIBFCACHE_S3_FIFO_QUEUE_FREE - 1 ];
+	}
+	while( safe_slot == -1 )
+	{
+		if( ( slot_queues->last_slots[ LIBFCACHE_S3_FIFO_QUEUE_SMALL - 1 ] != -1 )
+		 && ( ( slot_queues->queue_sizes[ LIBFCACHE_S3_FIFO_QUEUE_SMALL - 1 ] >= s3_fifo->maximum_small_queue_size )
+		  ||  ( slot_queues->last_slots[ LIBFCACHE_S3_FIFO_QUEUE_MAIN - 1 ] == -1 ) ) )
+		{
+			queue_number = LIBFCACHE_S3_FIFO_QUEUE_SMALL;
+		}
+		else
+		{
+			queue_number = LIBFCACHE_S3_FIFO_QUEUE_MAIN;
+		}
+		last_slot = slot_queues->last_slots[ queue_number - 1 ];
+
+		if( last_slot == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid S3-FIFO - missing slots.",
+			 function );
+
+			return( -1 );
+		}
+		/* The value of a slot in the small queue is referenced once directly
+		 * after it is set, hence it must be referenced at least twice to be
+		 * moved to the main queue
+		 */
+		if( ( queue_number == LIBFCACHE_S3_FIFO_QUEUE_SMALL )
+		 && ( s3_fifo->frequencies[ last_slot ] > 1 ) )
+		{
+			s3_fifo->frequencies[ last_slot ] = 0;
+		}
+		else if( ( queue_number == LIBFCACHE_S3_FIFO_QUEUE_MAIN )
+		      && ( s3_fifo->frequencies[ last_slot ] > 0 ) )
+		{
+			s3_fifo->frequencies[ last_slot ] -= 1;
+		}
+		else
+		{
+			safe_slot = last_slot;
+
+			break;
+		}
+		if( libfcache_slot_queues_prepend_slot(
+		     slot_queues,
+		     LIBFCACHE_S3_FIFO_QUEUE_MAIN,
+		     last_slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend slot: %d to main queue.",
+			 function,
+			 last_slot );
+
+			return( -1 );
+		}
+	}
+	*slot = safe_slot;
+
+	return( 1 );
+}
+
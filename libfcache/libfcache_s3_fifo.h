@@ -0,0 +1,128 @@
+/*
+ * S3-FIFO replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_S3_FIFO_H )
+#define _LIBFCACHE_S3_FIFO_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_slot_queues.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_s3_fifo libfcache_s3_fifo_t;
+
+struct libfcache_s3_fifo
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The maximum number of slots in the small queue before it is preferred for eviction
+	 */
+	int maximum_small_queue_size;
+
+	/* The slot queues, contains the free, small and main queue
+	 * The free queue contains the slots of which the value was removed,
+	 * the small queue is a FIFO of the recently inserted slots and
+	 * the main queue is a FIFO of the slots that were referenced again
+	 * while in the small queue or after they were evicted from it
+	 */
+	libfcache_slot_queues_t *slot_queues;
+
+	/* The frequencies, one per slot, the number of times the slot was
+	 * referenced, up to a maximum of 3
+	 */
+	uint8_t *frequencies;
+
+	/* The ghost table, contains the identifiers recently evicted from the small queue
+	 */
+	libfcache_hash_table_t *ghost_table;
+
+	/* The number of ghost slots
+	 */
+	int number_of_ghost_slots;
+
+	/* The ghost slot that is reused next
+	 */
+	int ghost_slot;
+};
+
+int libfcache_s3_fifo_initialize(
+     libfcache_s3_fifo_t **s3_fifo,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_free(
+     libfcache_s3_fifo_t **s3_fifo,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_clear(
+     libfcache_s3_fifo_t *s3_fifo,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_resize(
+     libfcache_s3_fifo_t *s3_fifo,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_insert_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_reference_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_remove_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_evict_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_s3_fifo_get_victim_slot(
+     libfcache_s3_fifo_t *s3_fifo,
+     int *slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_S3_FIFO_H ) */
+
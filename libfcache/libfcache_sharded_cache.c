@@ -0,0 +1,1110 @@
+/*
+ * The sharded cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libfcache_cache.h"
+#include "libfcache_cache_value.h"
+#include "libfcache_definitions.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_sharded_cache.h"
+#include "libfcache_types.h"
+
+/* Retrieves the default number of shards
+ * The default number of shards is the number of online processors
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_get_default_number_of_shards(
+     int *number_of_shards,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	SYSTEM_INFO system_info;
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	long number_of_processors = 0;
+#endif
+	static char *function     = "libfcache_sharded_cache_get_default_number_of_shards";
+
+	if( number_of_shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of shards.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_shards = 1;
+
+#if defined( WINAPI )
+	GetSystemInfo(
+	 &system_info );
+
+	if( system_info.dwNumberOfProcessors > 1 )
+	{
+		*number_of_shards = (int) system_info.dwNumberOfProcessors;
+	}
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	number_of_processors = sysconf(
+	                        _SC_NPROCESSORS_ONLN );
+
+	/* sysconf returns -1 if the number of processors cannot be determined
+	 */
+	if( number_of_processors > 1 )
+	{
+		*number_of_shards = (int) number_of_processors;
+	}
+#endif
+	if( *number_of_shards > LIBFCACHE_SHARDED_CACHE_MAXIMUM_NUMBER_OF_SHARDS )
+	{
+		*number_of_shards = LIBFCACHE_SHARDED_CACHE_MAXIMUM_NUMBER_OF_SHARDS;
+	}
+	return( 1 );
+}
+
+/* Creates a sharded cache
+ * The cache entries are divided over a number of independently locked caches (shards)
+ * If number of shards is 0 the number of online processors is used
+ * The flags are applied to every shard
+ * Make sure the value sharded_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_initialize(
+     libfcache_sharded_cache_t **sharded_cache,
+     int maximum_cache_entries,
+     int number_of_shards,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_initialize";
+	size_t shards_size                                         = 0;
+	int maximum_shard_entries                                  = 0;
+	int shard_index                                            = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sharded_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sharded cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_shards < 0 )
+	 || ( number_of_shards > LIBFCACHE_SHARDED_CACHE_MAXIMUM_NUMBER_OF_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of shards value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_shards == 0 )
+	{
+		if( libfcache_sharded_cache_get_default_number_of_shards(
+		     &number_of_shards,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve default number of shards.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Every shard should be able to contain at least one cache entry
+	 */
+	if( number_of_shards > maximum_cache_entries )
+	{
+		number_of_shards = maximum_cache_entries;
+	}
+	maximum_shard_entries = maximum_cache_entries / number_of_shards;
+
+	if( ( maximum_cache_entries % number_of_shards ) != 0 )
+	{
+		maximum_shard_entries += 1;
+	}
+	internal_sharded_cache = memory_allocate_structure(
+	                          libfcache_internal_sharded_cache_t );
+
+	if( internal_sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sharded cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_sharded_cache,
+	     0,
+	     sizeof( libfcache_internal_sharded_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sharded cache.",
+		 function );
+
+		memory_free(
+		 internal_sharded_cache );
+
+		return( -1 );
+	}
+	shards_size = sizeof( libfcache_cache_t * ) * number_of_shards;
+
+	internal_sharded_cache->shards = (libfcache_cache_t **) memory_allocate(
+	                                                         shards_size );
+
+	if( internal_sharded_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_sharded_cache->shards,
+	     0,
+	     shards_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		goto on_error;
+	}
+	internal_sharded_cache->number_of_shards = number_of_shards;
+
+	for( shard_index = 0;
+	     shard_index < number_of_shards;
+	     shard_index++ )
+	{
+		if( libfcache_cache_initialize_with_flags(
+		     &( internal_sharded_cache->shards[ shard_index ] ),
+		     maximum_shard_entries,
+		     flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+	}
+	*sharded_cache = (libfcache_sharded_cache_t *) internal_sharded_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_sharded_cache != NULL )
+	{
+		if( internal_sharded_cache->shards != NULL )
+		{
+			for( shard_index = 0;
+			     shard_index < internal_sharded_cache->number_of_shards;
+			     shard_index++ )
+			{
+				if( internal_sharded_cache->shards[ shard_index ] != NULL )
+				{
+					libfcache_cache_free(
+					 &( internal_sharded_cache->shards[ shard_index ] ),
+					 NULL );
+				}
+			}
+			memory_free(
+			 internal_sharded_cache->shards );
+		}
+		memory_free(
+		 internal_sharded_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a sharded cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_free(
+     libfcache_sharded_cache_t **sharded_cache,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_free";
+	int result                                                 = 1;
+	int shard_index                                            = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sharded_cache != NULL )
+	{
+		internal_sharded_cache = (libfcache_internal_sharded_cache_t *) *sharded_cache;
+		*sharded_cache         = NULL;
+
+		for( shard_index = 0;
+		     shard_index < internal_sharded_cache->number_of_shards;
+		     shard_index++ )
+		{
+			if( libfcache_cache_free(
+			     &( internal_sharded_cache->shards[ shard_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_sharded_cache->shards );
+
+		memory_free(
+		 internal_sharded_cache );
+	}
+	return( result );
+}
+
+/* Empties the sharded cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_empty(
+     libfcache_sharded_cache_t *sharded_cache,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_empty";
+	int shard_index                                            = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	for( shard_index = 0;
+	     shard_index < internal_sharded_cache->number_of_shards;
+	     shard_index++ )
+	{
+		if( libfcache_cache_empty(
+		     internal_sharded_cache->shards[ shard_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Invalidates the cache values of a specific file index in all the shards
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_invalidate_file(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_invalidate_file";
+	int shard_index                                            = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	/* The cache values of a file index are distributed over all the shards
+	 */
+	for( shard_index = 0;
+	     shard_index < internal_sharded_cache->number_of_shards;
+	     shard_index++ )
+	{
+		if( libfcache_cache_invalidate_file(
+		     internal_sharded_cache->shards[ shard_index ],
+		     file_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate cache values of file index: %d in shard: %d.",
+			 function,
+			 file_index,
+			 shard_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Invalidates the cache values of a specific file index within an offset range in all the shards
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_invalidate_range(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_invalidate_range";
+	int shard_index                                            = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	/* The cache values of a file index are distributed over all the shards
+	 * hence every shard contains part of the range
+	 */
+	for( shard_index = 0;
+	     shard_index < internal_sharded_cache->number_of_shards;
+	     shard_index++ )
+	{
+		if( libfcache_cache_invalidate_range(
+		     internal_sharded_cache->shards[ shard_index ],
+		     file_index,
+		     range_offset,
+		     range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate cache values of file index: %d in range in shard: %d.",
+			 function,
+			 file_index,
+			 shard_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calls a callback function for the cache values of a specific file index within an offset range in all the shards
+ * The cache values are passed in order of their offset per shard, not over all the shards
+ * Returns 1 if successful, 0 if the iteration was stopped or -1 on error
+ */
+int libfcache_sharded_cache_iterate_values_in_range(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*callback_function)(
+            libfcache_cache_value_t *cache_value,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_iterate_values_in_range";
+	int result                                                 = 0;
+	int shard_index                                            = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	/* The cache values of a file index are distributed over all the shards
+	 * hence every shard contains part of the range
+	 */
+	for( shard_index = 0;
+	     shard_index < internal_sharded_cache->number_of_shards;
+	     shard_index++ )
+	{
+		result = libfcache_cache_iterate_values_in_range(
+		          internal_sharded_cache->shards[ shard_index ],
+		          file_index,
+		          range_offset,
+		          range_size,
+		          callback_function,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to iterate cache values of file index: %d in range in shard: %d.",
+			 function,
+			 file_index,
+			 shard_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the shard of a specific identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_internal_sharded_cache_get_shard_by_identifier(
+     libfcache_internal_sharded_cache_t *internal_sharded_cache,
+     int file_index,
+     off64_t offset,
+     libfcache_cache_t **shard,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_internal_sharded_cache_get_shard_by_identifier";
+	uint32_t hash         = 0;
+	int shard_index       = 0;
+
+	if( internal_sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	/* The timestamp is not part of the hash so that all the versions
+	 * of a cache value end up in the same shard
+	 */
+	hash = libfcache_hash_table_calculate_hash(
+	        file_index,
+	        offset,
+	        0 );
+
+	/* The shards use the lower bits of the same hash to index their slots,
+	 * hence the hash is remixed before the shard index is determined
+	 * from its upper bits
+	 */
+	hash *= 0x9e3779b1UL;
+
+	shard_index = (int) ( ( (uint64_t) hash * (uint64_t) internal_sharded_cache->number_of_shards ) >> 32 );
+
+	*shard = internal_sharded_cache->shards[ shard_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the number of shards
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_get_number_of_shards(
+     libfcache_sharded_cache_t *sharded_cache,
+     int *number_of_shards,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_get_number_of_shards";
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	if( number_of_shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of shards.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_shards = internal_sharded_cache->number_of_shards;
+
+	return( 1 );
+}
+
+/* Retrieves the number of cache values
+ * The number is the sum of the number of cache values of every shard
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_get_number_of_cache_values(
+     libfcache_sharded_cache_t *sharded_cache,
+     int *number_of_cache_values,
+     libcerror_error_t **error )
+{
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_get_number_of_cache_values";
+	int number_of_shard_values                                 = 0;
+	int shard_index                                            = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	if( number_of_cache_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_cache_values = 0;
+
+	for( shard_index = 0;
+	     shard_index < internal_sharded_cache->number_of_shards;
+	     shard_index++ )
+	{
+		if( libfcache_cache_get_number_of_cache_values(
+		     internal_sharded_cache->shards[ shard_index ],
+		     &number_of_shard_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache values of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		*number_of_cache_values += number_of_shard_values;
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache value that matches the file index, offset and timestamp
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_sharded_cache_get_value_by_identifier(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *shard                                   = NULL;
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_get_value_by_identifier";
+	int result                                                 = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	if( libfcache_internal_sharded_cache_get_shard_by_identifier(
+	     internal_sharded_cache,
+	     file_index,
+	     offset,
+	     &shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shard.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          shard,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the cache value for the file index, offset and timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_set_value_by_identifier(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_sharded_cache_set_value_by_identifier";
+
+	if( libfcache_sharded_cache_set_value_by_identifier_with_cost(
+	     sharded_cache,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     0,
+	     0,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the cache value and value size for the file index, offset and timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_set_value_by_identifier_with_size(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_sharded_cache_set_value_by_identifier_with_size";
+
+	if( libfcache_sharded_cache_set_value_by_identifier_with_cost(
+	     sharded_cache,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     value_size,
+	     0,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the cache value, value size and value cost for the file index, offset and timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_set_value_by_identifier_with_cost(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *shard                                   = NULL;
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_set_value_by_identifier_with_cost";
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	if( libfcache_internal_sharded_cache_get_shard_by_identifier(
+	     internal_sharded_cache,
+	     file_index,
+	     offset,
+	     &shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_set_value_by_identifier_with_cost(
+	     shard,
+	     file_index,
+	     offset,
+	     timestamp,
+	     value,
+	     value_size,
+	     value_cost,
+	     value_free_function,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Acquires the cache value that matches the file index, offset and timestamp
+ * The cache value is pinned until it is released with libfcache_sharded_cache_release_value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_sharded_cache_acquire_value_by_identifier(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *shard                                   = NULL;
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_acquire_value_by_identifier";
+	int result                                                 = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	if( libfcache_internal_sharded_cache_get_shard_by_identifier(
+	     internal_sharded_cache,
+	     file_index,
+	     offset,
+	     &shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shard.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_cache_acquire_value_by_identifier(
+	          shard,
+	          file_index,
+	          offset,
+	          timestamp,
+	          cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to acquire cache value by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases a cache value that was acquired
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_sharded_cache_release_value(
+     libfcache_sharded_cache_t *sharded_cache,
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *shard                                   = NULL;
+	libfcache_internal_sharded_cache_t *internal_sharded_cache = NULL;
+	static char *function                                      = "libfcache_sharded_cache_release_value";
+	off64_t offset                                             = 0;
+	int64_t timestamp                                          = 0;
+	int file_index                                             = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_cache = (libfcache_internal_sharded_cache_t *) sharded_cache;
+
+	/* The identifier of a pinned cache value cannot change
+	 * hence it can be used to determine the shard
+	 */
+	if( libfcache_cache_value_get_identifier(
+	     cache_value,
+	     &file_index,
+	     &offset,
+	     &timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_internal_sharded_cache_get_shard_by_identifier(
+	     internal_sharded_cache,
+	     file_index,
+	     offset,
+	     &shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_release_value(
+	     shard,
+	     cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cache value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
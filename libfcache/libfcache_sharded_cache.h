@@ -0,0 +1,188 @@
+/*
+ * The sharded cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_SHARDED_CACHE_H )
+#define _LIBFCACHE_SHARDED_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_extern.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_internal_sharded_cache libfcache_internal_sharded_cache_t;
+
+struct libfcache_internal_sharded_cache
+{
+	/* The number of shards
+	 */
+	int number_of_shards;
+
+	/* The shards, the caches that contain the cache values
+	 */
+	libfcache_cache_t **shards;
+};
+
+int libfcache_sharded_cache_get_default_number_of_shards(
+     int *number_of_shards,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_initialize(
+     libfcache_sharded_cache_t **sharded_cache,
+     int maximum_cache_entries,
+     int number_of_shards,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_free(
+     libfcache_sharded_cache_t **sharded_cache,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_empty(
+     libfcache_sharded_cache_t *sharded_cache,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_invalidate_file(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_invalidate_range(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_iterate_values_in_range(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*callback_function)(
+            libfcache_cache_value_t *cache_value,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libfcache_internal_sharded_cache_get_shard_by_identifier(
+     libfcache_internal_sharded_cache_t *internal_sharded_cache,
+     int file_index,
+     off64_t offset,
+     libfcache_cache_t **shard,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_get_number_of_shards(
+     libfcache_sharded_cache_t *sharded_cache,
+     int *number_of_shards,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_get_number_of_cache_values(
+     libfcache_sharded_cache_t *sharded_cache,
+     int *number_of_cache_values,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_get_value_by_identifier(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_set_value_by_identifier(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_set_value_by_identifier_with_size(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_set_value_by_identifier_with_cost(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t *value,
+     size_t value_size,
+     uint32_t value_cost,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_acquire_value_by_identifier(
+     libfcache_sharded_cache_t *sharded_cache,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_sharded_cache_release_value(
+     libfcache_sharded_cache_t *sharded_cache,
+     libfcache_cache_value_t *cache_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_SHARDED_CACHE_H ) */
+
@@ -0,0 +1,921 @@
+/*
+ * Slot queues functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_slot_queues.h"
+
+
+/* Unlinks a slot from its queue
+ */
+static void libfcache_slot_queues_unlink_slot(
+             libfcache_slot_queues_t *slot_queues,
+             int slot )
+{
+	int next_slot     = 0;
+	int previous_slot = 0;
+	int queue_index   = 0;
+
+	if( slot_queues->queue_numbers[ slot ] == 0 )
+	{
+		return;
+	}
+	queue_index   = slot_queues->queue_numbers[ slot ] - 1;
+	previous_slot = slot_queues->previous_slots[ slot ];
+	next_slot     = slot_queues->next_slots[ slot ];
+
+	if( previous_slot == -1 )
+	{
+		slot_queues->first_slots[ queue_index ] = next_slot;
+	}
+	else
+	{
+		slot_queues->next_slots[ previous_slot ] = next_slot;
+	}
+	if( next_slot == -1 )
+	{
+		slot_queues->last_slots[ queue_index ] = previous_slot;
+	}
+	else
+	{
+		slot_queues->previous_slots[ next_slot ] = previous_slot;
+	}
+	slot_queues->queue_sizes[ queue_index ] -= 1;
+
+	slot_queues->previous_slots[ slot ] = -1;
+	slot_queues->next_slots[ slot ]     = -1;
+	slot_queues->queue_numbers[ slot ]  = 0;
+}
+
+/* Resets the queues and the links of the slots
+ */
+static void libfcache_slot_queues_reset(
+             libfcache_slot_queues_t *slot_queues )
+{
+	int queue_index = 0;
+	int slot        = 0;
+
+	for( queue_index = 0;
+	     queue_index < LIBFCACHE_SLOT_QUEUES_MAXIMUM_NUMBER_OF_QUEUES;
+	     queue_index++ )
+	{
+		slot_queues->first_slots[ queue_index ] = -1;
+		slot_queues->last_slots[ queue_index ]  = -1;
+		slot_queues->queue_sizes[ queue_index ] = 0;
+	}
+	for( slot = 0;
+	     slot < slot_queues->number_of_slots;
+	     slot++ )
+	{
+		slot_queues->previous_slots[ slot ] = -1;
+		slot_queues->next_slots[ slot ]     = -1;
+		slot_queues->queue_numbers[ slot ]  = 0;
+	}
+}
+
+/* Creates slot queues
+ * Make sure the value slot_queues is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_initialize(
+     libfcache_slot_queues_t **slot_queues,
+     int number_of_slots,
+     int number_of_queues,
+     libcerror_error_t **error )
+{
+	libfcache_slot_queues_t *safe_slot_queues = NULL;
+	static char *function                     = "libfcache_slot_queues_initialize";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( *slot_queues != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid slot queues value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_queues <= 0 )
+	 || ( number_of_queues > LIBFCACHE_SLOT_QUEUES_MAXIMUM_NUMBER_OF_QUEUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of queues value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_slot_queues = memory_allocate_structure(
+	                    libfcache_slot_queues_t );
+
+	if( safe_slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot queues.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_slot_queues,
+	     0,
+	     sizeof( libfcache_slot_queues_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slot queues.",
+		 function );
+
+		memory_free(
+		 safe_slot_queues );
+
+		return( -1 );
+	}
+	safe_slot_queues->previous_slots = (int *) memory_allocate(
+	                                            sizeof( int ) * number_of_slots );
+
+	if( safe_slot_queues->previous_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create previous slots.",
+		 function );
+
+		goto on_error;
+	}
+	safe_slot_queues->next_slots = (int *) memory_allocate(
+	                                        sizeof( int ) * number_of_slots );
+
+	if( safe_slot_queues->next_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create next slots.",
+		 function );
+
+		goto on_error;
+	}
+	safe_slot_queues->queue_numbers = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * number_of_slots );
+
+	if( safe_slot_queues->queue_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue numbers.",
+		 function );
+
+		goto on_error;
+	}
+	safe_slot_queues->number_of_slots  = number_of_slots;
+	safe_slot_queues->number_of_queues = number_of_queues;
+
+	libfcache_slot_queues_reset(
+	 safe_slot_queues );
+
+	*slot_queues = safe_slot_queues;
+
+	return( 1 );
+
+on_error:
+	if( safe_slot_queues != NULL )
+	{
+		if( safe_slot_queues->queue_numbers != NULL )
+		{
+			memory_free(
+			 safe_slot_queues->queue_numbers );
+		}
+		if( safe_slot_queues->next_slots != NULL )
+		{
+			memory_free(
+			 safe_slot_queues->next_slots );
+		}
+		if( safe_slot_queues->previous_slots != NULL )
+		{
+			memory_free(
+			 safe_slot_queues->previous_slots );
+		}
+		memory_free(
+		 safe_slot_queues );
+	}
+	return( -1 );
+}
+
+/* Frees slot queues
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_free(
+     libfcache_slot_queues_t **slot_queues,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_free";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( *slot_queues != NULL )
+	{
+		if( ( *slot_queues )->queue_numbers != NULL )
+		{
+			memory_free(
+			 ( *slot_queues )->queue_numbers );
+		}
+		if( ( *slot_queues )->next_slots != NULL )
+		{
+			memory_free(
+			 ( *slot_queues )->next_slots );
+		}
+		if( ( *slot_queues )->previous_slots != NULL )
+		{
+			memory_free(
+			 ( *slot_queues )->previous_slots );
+		}
+		memory_free(
+		 *slot_queues );
+
+		*slot_queues = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the slot queues
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_clear(
+     libfcache_slot_queues_t *slot_queues,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_clear";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_slot_queues_reset(
+	 slot_queues );
+
+	return( 1 );
+}
+
+/* Resizes the slot queues
+ * The slots that remain retain their position in the queues
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_resize(
+     libfcache_slot_queues_t *slot_queues,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_resize";
+	void *reallocation    = NULL;
+	int slot              = 0;
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Unlink the slots that are removed by the resize
+	 */
+	for( slot = number_of_slots;
+	     slot < slot_queues->number_of_slots;
+	     slot++ )
+	{
+		libfcache_slot_queues_unlink_slot(
+		 slot_queues,
+		 slot );
+	}
+	reallocation = memory_reallocate(
+	                slot_queues->previous_slots,
+	                sizeof( int ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize previous slots.",
+		 function );
+
+		return( -1 );
+	}
+	slot_queues->previous_slots = (int *) reallocation;
+
+	reallocation = memory_reallocate(
+	                slot_queues->next_slots,
+	                sizeof( int ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize next slots.",
+		 function );
+
+		return( -1 );
+	}
+	slot_queues->next_slots = (int *) reallocation;
+
+	reallocation = memory_reallocate(
+	                slot_queues->queue_numbers,
+	                sizeof( uint8_t ) * number_of_slots );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize queue numbers.",
+		 function );
+
+		return( -1 );
+	}
+	slot_queues->queue_numbers = (uint8_t *) reallocation;
+
+	for( slot = slot_queues->number_of_slots;
+	     slot < number_of_slots;
+	     slot++ )
+	{
+		slot_queues->previous_slots[ slot ] = -1;
+		slot_queues->next_slots[ slot ]     = -1;
+		slot_queues->queue_numbers[ slot ]  = 0;
+	}
+	slot_queues->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Retrieves the queue number of a slot
+ * The queue number is 0 if the slot is not in a queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_get_queue_number(
+     libfcache_slot_queues_t *slot_queues,
+     int slot,
+     uint8_t *queue_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_get_queue_number";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= slot_queues->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue number.",
+		 function );
+
+		return( -1 );
+	}
+	*queue_number = slot_queues->queue_numbers[ slot ];
+
+	return( 1 );
+}
+
+/* Retrieves the first (most recently added) slot of a queue
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int libfcache_slot_queues_get_first_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_get_first_slot";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_number == 0 )
+	 || ( (int) queue_number > slot_queues->number_of_queues ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_queues->first_slots[ queue_number - 1 ] == -1 )
+	{
+		return( 0 );
+	}
+	*slot = slot_queues->first_slots[ queue_number - 1 ];
+
+	return( 1 );
+}
+
+/* Retrieves the last (least recently added) slot of a queue
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int libfcache_slot_queues_get_last_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int *slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_get_last_slot";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_number == 0 )
+	 || ( (int) queue_number > slot_queues->number_of_queues ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_queues->last_slots[ queue_number - 1 ] == -1 )
+	{
+		return( 0 );
+	}
+	*slot = slot_queues->last_slots[ queue_number - 1 ];
+
+	return( 1 );
+}
+
+/* Retrieves the previous (more recently added) slot of a slot
+ * Returns 1 if successful, 0 if the slot has no previous slot or -1 on error
+ */
+int libfcache_slot_queues_get_previous_slot(
+     libfcache_slot_queues_t *slot_queues,
+     int slot,
+     int *previous_slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_get_previous_slot";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= slot_queues->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_queues->previous_slots[ slot ] == -1 )
+	{
+		return( 0 );
+	}
+	*previous_slot = slot_queues->previous_slots[ slot ];
+
+	return( 1 );
+}
+
+/* Retrieves the number of slots in a queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_get_queue_size(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int *queue_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_get_queue_size";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_number == 0 )
+	 || ( (int) queue_number > slot_queues->number_of_queues ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue size.",
+		 function );
+
+		return( -1 );
+	}
+	*queue_size = slot_queues->queue_sizes[ queue_number - 1 ];
+
+	return( 1 );
+}
+
+/* Prepends a slot to a queue, the slot becomes the first (most recently added) slot
+ * The slot is removed from the queue it was in
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_prepend_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_prepend_slot";
+	int queue_index       = 0;
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_number == 0 )
+	 || ( (int) queue_number > slot_queues->number_of_queues ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= slot_queues->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	queue_index = queue_number - 1;
+
+	if( ( slot_queues->queue_numbers[ slot ] == queue_number )
+	 && ( slot_queues->first_slots[ queue_index ] == slot ) )
+	{
+		return( 1 );
+	}
+	libfcache_slot_queues_unlink_slot(
+	 slot_queues,
+	 slot );
+
+	slot_queues->previous_slots[ slot ] = -1;
+	slot_queues->next_slots[ slot ]     = slot_queues->first_slots[ queue_index ];
+	slot_queues->queue_numbers[ slot ]  = queue_number;
+
+	if( slot_queues->first_slots[ queue_index ] == -1 )
+	{
+		slot_queues->last_slots[ queue_index ] = slot;
+	}
+	else
+	{
+		slot_queues->previous_slots[ slot_queues->first_slots[ queue_index ] ] = slot;
+	}
+	slot_queues->first_slots[ queue_index ]  = slot;
+	slot_queues->queue_sizes[ queue_index ] += 1;
+
+	return( 1 );
+}
+
+/* Appends a slot to a queue, the slot becomes the last (least recently added) slot
+ * The slot is removed from the queue it was in
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_append_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_append_slot";
+	int queue_index       = 0;
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_number == 0 )
+	 || ( (int) queue_number > slot_queues->number_of_queues ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= slot_queues->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	queue_index = queue_number - 1;
+
+	if( ( slot_queues->queue_numbers[ slot ] == queue_number )
+	 && ( slot_queues->last_slots[ queue_index ] == slot ) )
+	{
+		return( 1 );
+	}
+	libfcache_slot_queues_unlink_slot(
+	 slot_queues,
+	 slot );
+
+	slot_queues->previous_slots[ slot ] = slot_queues->last_slots[ queue_index ];
+	slot_queues->next_slots[ slot ]     = -1;
+	slot_queues->queue_numbers[ slot ]  = queue_number;
+
+	if( slot_queues->last_slots[ queue_index ] == -1 )
+	{
+		slot_queues->first_slots[ queue_index ] = slot;
+	}
+	else
+	{
+		slot_queues->next_slots[ slot_queues->last_slots[ queue_index ] ] = slot;
+	}
+	slot_queues->last_slots[ queue_index ]   = slot;
+	slot_queues->queue_sizes[ queue_index ] += 1;
+
+	return( 1 );
+}
+
+/* Removes a slot from its queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_slot_queues_remove_slot(
+     libfcache_slot_queues_t *slot_queues,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_slot_queues_remove_slot";
+
+	if( slot_queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= slot_queues->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_slot_queues_unlink_slot(
+	 slot_queues,
+	 slot );
+
+	return( 1 );
+}
+
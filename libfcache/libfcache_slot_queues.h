@@ -0,0 +1,143 @@
+/*
+ * Slot queues functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_SLOT_QUEUES_H )
+#define _LIBFCACHE_SLOT_QUEUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_slot_queues libfcache_slot_queues_t;
+
+struct libfcache_slot_queues
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The number of queues
+	 */
+	int number_of_queues;
+
+	/* The previous slots, one per slot, contains -1 if there is no previous slot
+	 */
+	int *previous_slots;
+
+	/* The next slots, one per slot, contains -1 if there is no next slot
+	 */
+	int *next_slots;
+
+	/* The queue numbers, one per slot, contains 0 if the slot is not in a queue
+	 */
+	uint8_t *queue_numbers;
+
+	/* The first (most recently added) slot of each queue, contains -1 if the queue is empty
+	 */
+	int first_slots[ LIBFCACHE_SLOT_QUEUES_MAXIMUM_NUMBER_OF_QUEUES ];
+
+	/* The last (least recently added) slot of each queue, contains -1 if the queue is empty
+	 */
+	int last_slots[ LIBFCACHE_SLOT_QUEUES_MAXIMUM_NUMBER_OF_QUEUES ];
+
+	/* The number of slots in each queue
+	 */
+	int queue_sizes[ LIBFCACHE_SLOT_QUEUES_MAXIMUM_NUMBER_OF_QUEUES ];
+};
+
+int libfcache_slot_queues_initialize(
+     libfcache_slot_queues_t **slot_queues,
+     int number_of_slots,
+     int number_of_queues,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_free(
+     libfcache_slot_queues_t **slot_queues,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_clear(
+     libfcache_slot_queues_t *slot_queues,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_resize(
+     libfcache_slot_queues_t *slot_queues,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_get_queue_number(
+     libfcache_slot_queues_t *slot_queues,
+     int slot,
+     uint8_t *queue_number,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_get_first_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int *slot,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_get_last_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int *slot,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_get_previous_slot(
+     libfcache_slot_queues_t *slot_queues,
+     int slot,
+     int *previous_slot,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_get_queue_size(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int *queue_size,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_prepend_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_append_slot(
+     libfcache_slot_queues_t *slot_queues,
+     uint8_t queue_number,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_slot_queues_remove_slot(
+     libfcache_slot_queues_t *slot_queues,
+     int slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_SLOT_QUEUES_H ) */
+
@@ -0,0 +1,748 @@
+/*
+ * 2Q (two queue) replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcache_definitions.h"
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_slot_queues.h"
+#include "libfcache_two_queue.h"
+
+
+/* Sets the queue sizes for a specific number of slots
+ * The in queue holds about 25% of the slots and the ghost table remembers
+ * about 50% of the slots, which are the values suggested for 2Q
+ */
+static void libfcache_two_queue_set_sizes(
+             libfcache_two_queue_t *two_queue,
+             int number_of_slots )
+{
+	two_queue->number_of_slots       = number_of_slots;
+	two_queue->maximum_in_queue_size = number_of_slots / 4;
+	two_queue->number_of_ghost_slots = number_of_slots / 2;
+
+	if( two_queue->maximum_in_queue_size == 0 )
+	{
+		two_queue->maximum_in_queue_size = 1;
+	}
+	if( two_queue->number_of_ghost_slots == 0 )
+	{
+		two_queue->number_of_ghost_slots = 1;
+	}
+	if( two_queue->ghost_slot >= two_queue->number_of_ghost_slots )
+	{
+		two_queue->ghost_slot = 0;
+	}
+}
+
+/* Creates a 2Q
+ * Make sure the value two_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_initialize(
+     libfcache_two_queue_t **two_queue,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfcache_two_queue_t *safe_two_queue = NULL;
+	static char *function                 = "libfcache_two_queue_initialize";
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( *two_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid 2Q value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_two_queue = memory_allocate_structure(
+	                  libfcache_two_queue_t );
+
+	if( safe_two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create 2Q.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_two_queue,
+	     0,
+	     sizeof( libfcache_two_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear 2Q.",
+		 function );
+
+		memory_free(
+		 safe_two_queue );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_initialize(
+	     &( safe_two_queue->slot_queues ),
+	     number_of_slots,
+	     LIBFCACHE_TWO_QUEUE_NUMBER_OF_QUEUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create slot queues.",
+		 function );
+
+		goto on_error;
+	}
+	libfcache_two_queue_set_sizes(
+	 safe_two_queue,
+	 number_of_slots );
+
+	if( libfcache_hash_table_initialize(
+	     &( safe_two_queue->ghost_table ),
+	     safe_two_queue->number_of_ghost_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create ghost table.",
+		 function );
+
+		goto on_error;
+	}
+	*two_queue = safe_two_queue;
+
+	return( 1 );
+
+on_error:
+	if( safe_two_queue != NULL )
+	{
+		if( safe_two_queue->slot_queues != NULL )
+		{
+			libfcache_slot_queues_free(
+			 &( safe_two_queue->slot_queues ),
+			 NULL );
+		}
+		memory_free(
+		 safe_two_queue );
+	}
+	return( -1 );
+}
+
+/* Frees a 2Q
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_free(
+     libfcache_two_queue_t **two_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_two_queue_free";
+	int result            = 1;
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( *two_queue != NULL )
+	{
+		if( libfcache_hash_table_free(
+		     &( ( *two_queue )->ghost_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free ghost table.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_slot_queues_free(
+		     &( ( *two_queue )->slot_queues ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free slot queues.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *two_queue );
+
+		*two_queue = NULL;
+	}
+	return( result );
+}
+
+/* Clears the 2Q
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_clear(
+     libfcache_two_queue_t *two_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_two_queue_clear";
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_hash_table_clear(
+	     two_queue->ghost_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear ghost table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_clear(
+	     two_queue->slot_queues,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	two_queue->ghost_slot = 0;
+
+	return( 1 );
+}
+
+/* Resizes the 2Q
+ * The slots that remain retain their position in the queues
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_resize(
+     libfcache_two_queue_t *two_queue,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_two_queue_resize";
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of slots value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_resize(
+	     two_queue->slot_queues,
+	     number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize slot queues.",
+		 function );
+
+		return( -1 );
+	}
+	libfcache_two_queue_set_sizes(
+	 two_queue,
+	 number_of_slots );
+
+	if( libfcache_hash_table_resize(
+	     two_queue->ghost_table,
+	     two_queue->number_of_ghost_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize ghost table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a slot
+ * The slot is inserted in the main queue if its identifier was recently
+ * evicted from the in queue, otherwise in the in queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_insert_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_two_queue_insert_slot";
+	uint8_t queue_type    = LIBFCACHE_TWO_QUEUE_TYPE_IN;
+	int ghost_slot        = 0;
+	int result            = 0;
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= two_queue->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_hash_table_get_slot_by_identifier(
+	          two_queue->ghost_table,
+	          file_index,
+	          offset,
+	          timestamp,
+	          &ghost_slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ghost slot.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_hash_table_remove_slot(
+		     two_queue->ghost_table,
+		     ghost_slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove ghost slot: %d.",
+			 function,
+			 ghost_slot );
+
+			return( -1 );
+		}
+		queue_type = LIBFCACHE_TWO_QUEUE_TYPE_MAIN;
+	}
+	if( libfcache_slot_queues_prepend_slot(
+	     two_queue->slot_queues,
+	     queue_type,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to prepend slot: %d to queue: %" PRIu8 ".",
+		 function,
+		 slot,
+		 queue_type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Marks a slot as referenced
+ * Only a slot in the main queue is moved, a slot in the in queue remains
+ * in FIFO order so that a scan of values that are referenced once cannot
+ * displace the main queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_reference_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_two_queue_reference_slot";
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= two_queue->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( two_queue->slot_queues->queue_numbers[ slot ] == LIBFCACHE_TWO_QUEUE_TYPE_MAIN )
+	{
+		if( libfcache_slot_queues_prepend_slot(
+		     two_queue->slot_queues,
+		     LIBFCACHE_TWO_QUEUE_TYPE_MAIN,
+		     slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend slot: %d to main queue.",
+			 function,
+			 slot );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes a slot
+ * The slot is moved to the free queue so that it is reused first
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_remove_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_two_queue_remove_slot";
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= two_queue->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_slot_queues_prepend_slot(
+	     two_queue->slot_queues,
+	     LIBFCACHE_TWO_QUEUE_TYPE_FREE,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to prepend slot: %d to free queue.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Evicts a slot
+ * The identifier of a slot evicted from the in queue is remembered in the ghost table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_evict_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_two_queue_evict_slot";
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot < 0 )
+	 || ( slot >= two_queue->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( two_queue->slot_queues->queue_numbers[ slot ] == LIBFCACHE_TWO_QUEUE_TYPE_IN )
+	{
+		/* The ghost slots are reused in FIFO order, insert replaces
+		 * the identifier previously stored in the ghost slot
+		 */
+		if( libfcache_hash_table_insert_slot(
+		     two_queue->ghost_table,
+		     two_queue->ghost_slot,
+		     file_index,
+		     offset,
+		     timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert ghost slot: %d.",
+			 function,
+			 two_queue->ghost_slot );
+
+			return( -1 );
+		}
+		two_queue->ghost_slot += 1;
+
+		if( two_queue->ghost_slot >= two_queue->number_of_ghost_slots )
+		{
+			two_queue->ghost_slot = 0;
+		}
+	}
+	if( libfcache_slot_queues_remove_slot(
+	     two_queue->slot_queues,
+	     slot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove slot: %d from queue.",
+		 function,
+		 slot );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the slot to reuse
+ * A free slot is reused first, otherwise the oldest slot of the in queue
+ * if it exceeds its maximum size, otherwise the least recently used slot
+ * of the main queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_two_queue_get_victim_slot(
+     libfcache_two_queue_t *two_queue,
+     int *slot,
+     libcerror_error_t **error )
+{
+	libfcache_slot_queues_t *slot_queues = NULL;
+	static char *function                = "libfcache_two_queue_get_victim_slot";
+	int safe_slot                        = -1;
+
+	if( two_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 2Q.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	slot_queues = two_queue->slot_queues;
+
+	if( slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_FREE - 1 ] != -1 )
+	{
+		safe_slot = slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_FREE - 1 ];
+	}
+	else if( ( slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_IN - 1 ] != -1 )
+	      && ( ( slot_queues->queue_sizes[ LIBFCACHE_TWO_QUEUE_TYPE_IN - 1 ] > two_queue->maximum_in_queue_size )
+	       ||  ( slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_MAIN - 1 ] == -1 ) ) )
+	{
+		safe_slot = slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_IN - 1 ];
+	}
+	else
+	{
+		safe_slot = slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_MAIN - 1 ];
+	}
+	if( safe_slot == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid 2Q - missing slots.",
+		 function );
+
+		return( -1 );
+	}
+	*slot = safe_slot;
+
+	return( 1 );
+}
+
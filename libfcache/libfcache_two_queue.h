@@ -0,0 +1,123 @@
+/*
+ * 2Q (two queue) replacement functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCACHE_TWO_QUEUE_H )
+#define _LIBFCACHE_TWO_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcache_hash_table.h"
+#include "libfcache_libcerror.h"
+#include "libfcache_slot_queues.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfcache_two_queue libfcache_two_queue_t;
+
+struct libfcache_two_queue
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The maximum number of slots in the in queue before it is preferred for eviction
+	 */
+	int maximum_in_queue_size;
+
+	/* The slot queues, contains the free, in and main queue
+	 * The free queue contains the slots of which the value was removed,
+	 * the in queue is a FIFO of the slots that were referenced once and
+	 * the main queue is a LRU of the slots that were referenced again
+	 * after they were evicted from the in queue
+	 */
+	libfcache_slot_queues_t *slot_queues;
+
+	/* The ghost table, contains the identifiers recently evicted from the in queue
+	 */
+	libfcache_hash_table_t *ghost_table;
+
+	/* The number of ghost slots
+	 */
+	int number_of_ghost_slots;
+
+	/* The ghost slot that is reused next
+	 */
+	int ghost_slot;
+};
+
+int libfcache_two_queue_initialize(
+     libfcache_two_queue_t **two_queue,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_free(
+     libfcache_two_queue_t **two_queue,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_clear(
+     libfcache_two_queue_t *two_queue,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_resize(
+     libfcache_two_queue_t *two_queue,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_insert_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_reference_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_remove_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_evict_slot(
+     libfcache_two_queue_t *two_queue,
+     int slot,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     libcerror_error_t **error );
+
+int libfcache_two_queue_get_victim_slot(
+     libfcache_two_queue_t *two_queue,
+     int *slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCACHE_TWO_QUEUE_H ) */
+
@@ -36,10 +36,14 @@
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libfcache_cache {}	libfcache_cache_t;
 typedef struct libfcache_cache_value {}	libfcache_cache_value_t;
+typedef struct libfcache_front_cache {}	libfcache_front_cache_t;
+typedef struct libfcache_sharded_cache {}	libfcache_sharded_cache_t;
 
 #else
 typedef intptr_t libfcache_cache_t;
 typedef intptr_t libfcache_cache_value_t;
+typedef intptr_t libfcache_front_cache_t;
+typedef intptr_t libfcache_sharded_cache_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
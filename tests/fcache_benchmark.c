@@ -0,0 +1,232 @@
+/*
+ * Library cache lookup benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_unused.h"
+
+/* The number of lookups per benchmark run
+ */
+#define FCACHE_BENCHMARK_NUMBER_OF_LOOKUPS	4194304
+
+/* The number of cache entries of the benchmark runs
+ */
+static int fcache_benchmark_number_of_cache_entries[ 3 ] = {
+	1024, 65536, 1048576 };
+
+static uint8_t fcache_benchmark_value_data[ 16 ];
+
+/* Retrieves a pseudo random cache entry index
+ * Returns the cache entry index
+ */
+int fcache_benchmark_get_random_index(
+     uint32_t *random_state,
+     int number_of_cache_entries )
+{
+	*random_state = ( *random_state * 1664525UL ) + 1013904223UL;
+
+	return( (int) ( ( *random_state >> 8 ) % (uint32_t) number_of_cache_entries ) );
+}
+
+/* Measures the lookup cost of a cache
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_benchmark_cache(
+     int number_of_cache_entries,
+     uint8_t flags,
+     const char *index_name,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	clock_t end_time                     = 0;
+	clock_t start_time                   = 0;
+	double hit_time                      = 0.0;
+	double miss_time                     = 0.0;
+	uint32_t random_state                = 1;
+	int cache_entry_index                = 0;
+	int lookup_index                     = 0;
+	int number_of_hits                   = 0;
+
+	if( libfcache_cache_initialize_with_flags(
+	     &cache,
+	     number_of_cache_entries,
+	     flags,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libfcache_cache_set_value_by_identifier(
+		     cache,
+		     0,
+		     (off64_t) cache_entry_index * 512,
+		     0,
+		     (intptr_t *) fcache_benchmark_value_data,
+		     NULL,
+		     LIBFCACHE_CACHE_VALUE_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	start_time = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < FCACHE_BENCHMARK_NUMBER_OF_LOOKUPS;
+	     lookup_index++ )
+	{
+		cache_entry_index = fcache_benchmark_get_random_index(
+		                     &random_state,
+		                     number_of_cache_entries );
+
+		if( libfcache_cache_get_value_by_identifier(
+		     cache,
+		     0,
+		     (off64_t) cache_entry_index * 512,
+		     0,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		number_of_hits++;
+	}
+	end_time = clock();
+	hit_time = ( (double) ( end_time - start_time ) / CLOCKS_PER_SEC ) * 1000000000.0 / FCACHE_BENCHMARK_NUMBER_OF_LOOKUPS;
+
+	start_time = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < FCACHE_BENCHMARK_NUMBER_OF_LOOKUPS;
+	     lookup_index++ )
+	{
+		cache_entry_index = fcache_benchmark_get_random_index(
+		                     &random_state,
+		                     number_of_cache_entries );
+
+		if( libfcache_cache_get_value_by_identifier(
+		     cache,
+		     0,
+		     ( (off64_t) cache_entry_index * 512 ) + 1,
+		     0,
+		     &cache_value,
+		     error ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	end_time  = clock();
+	miss_time = ( (double) ( end_time - start_time ) / CLOCKS_PER_SEC ) * 1000000000.0 / FCACHE_BENCHMARK_NUMBER_OF_LOOKUPS;
+
+	if( libfcache_cache_free(
+	     &cache,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "%8d entries\t%-12s\thit: %6.1f ns\tmiss: %6.1f ns\n",
+	 number_of_cache_entries,
+	 index_name,
+	 hit_time,
+	 miss_time );
+
+	return( 1 );
+
+on_error:
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	int run_index            = 0;
+
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	for( run_index = 0;
+	     run_index < 3;
+	     run_index++ )
+	{
+		if( fcache_benchmark_cache(
+		     fcache_benchmark_number_of_cache_entries[ run_index ],
+		     0,
+		     "hash table",
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fcache_benchmark_cache(
+		     fcache_benchmark_number_of_cache_entries[ run_index ],
+		     LIBFCACHE_CACHE_FLAG_FLAT_INDEX,
+		     "flat table",
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -27,6 +27,10 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
 #include "fcache_test_libcerror.h"
 #include "fcache_test_libfcache.h"
 #include "fcache_test_macros.h"
@@ -37,6 +41,10 @@
 
 int fcache_test_cache_value_free_function_return_value = 1;
 
+/* The number of times the test value free function was called
+ */
+int fcache_test_cache_value_free_function_number_of_calls = 0;
+
 /* Test value free function
  * Returns 1 if successful or -1 on error
  */
@@ -47,9 +55,179 @@ int fcache_test_cache_value_free_function(
 	FCACHE_TEST_UNREFERENCED_PARAMETER( value )
 	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
 
+	fcache_test_cache_value_free_function_number_of_calls++;
+
 	return( fcache_test_cache_value_free_function_return_value );
 }
 
+/* The most recently inserted slot of the test policy
+ */
+int fcache_test_cache_policy_last_slot = 0;
+
+/* The number of referenced slots of the test policy
+ */
+int fcache_test_cache_policy_number_of_references = 0;
+
+/* Test policy clear function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_policy_clear(
+     intptr_t *policy_data FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( policy_data )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	fcache_test_cache_policy_last_slot            = 0;
+	fcache_test_cache_policy_number_of_references = 0;
+
+	return( 1 );
+}
+
+/* Test policy resize function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_policy_resize(
+     intptr_t *policy_data FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int number_of_slots FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( policy_data )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( number_of_slots )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* Test policy insert slot function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_policy_insert_slot(
+     intptr_t *policy_data FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int slot,
+     int file_index FCACHE_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int64_t timestamp FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( policy_data )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( file_index )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( offset )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( timestamp )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	fcache_test_cache_policy_last_slot = slot;
+
+	return( 1 );
+}
+
+/* Test policy reference slot function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_policy_reference_slot(
+     intptr_t *policy_data FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int slot FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( policy_data )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( slot )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	fcache_test_cache_policy_number_of_references += 1;
+
+	return( 1 );
+}
+
+/* Test policy remove slot function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_policy_remove_slot(
+     intptr_t *policy_data FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int slot FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int file_index FCACHE_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int64_t timestamp FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( policy_data )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( slot )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( file_index )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( offset )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( timestamp )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* Test policy get victim slot function, that replaces the most recently inserted slot
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_policy_get_victim_slot(
+     intptr_t *policy_data FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int *slot,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( policy_data )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( slot == NULL )
+	{
+		return( -1 );
+	}
+	*slot = fcache_test_cache_policy_last_slot;
+
+	return( 1 );
+}
+
+/* The offset of the most recent cache value passed to the test iterate callback function
+ */
+off64_t fcache_test_cache_iterate_last_offset = -1;
+
+/* The number of cache values after which the test iterate callback function stops the iteration
+ */
+int fcache_test_cache_iterate_maximum_number_of_values = 0;
+
+/* Test iterate callback function
+ * Counts the cache values in callback_data and checks that they are passed in order of their offset
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fcache_test_cache_iterate_callback_function(
+     libfcache_cache_value_t *cache_value,
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	int *number_of_values = NULL;
+	int64_t timestamp     = 0;
+	off64_t offset        = 0;
+	int file_index        = 0;
+
+	if( libfcache_cache_value_get_identifier(
+	     cache_value,
+	     &file_index,
+	     &offset,
+	     &timestamp,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( offset <= fcache_test_cache_iterate_last_offset )
+	{
+		return( -1 );
+	}
+	fcache_test_cache_iterate_last_offset = offset;
+
+	number_of_values = (int *) callback_data;
+
+	*number_of_values += 1;
+
+	if( ( fcache_test_cache_iterate_maximum_number_of_values != 0 )
+	 && ( *number_of_values >= fcache_test_cache_iterate_maximum_number_of_values ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Tests the libfcache_cache_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -272,59 +450,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcache_cache_free function
+/* Tests the libfcache_cache_initialize_with_flags function
  * Returns 1 if successful or 0 if not
  */
-int fcache_test_cache_free(
+int fcache_test_cache_initialize_with_flags(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test error cases
-	 */
-	result = libfcache_cache_free(
-	          NULL,
-	          &error );
-
-	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	uint8_t value_data[ 16 ];
 
-/* Tests the libfcache_cache_empty function
- * Returns 1 if successful or 0 if not
- */
-int fcache_test_cache_empty(
-     void )
-{
-	libfcache_cache_t *cache = NULL;
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int cache_entry_index                = 0;
+	int result                           = 0;
 
-	/* Initialize test
+	/* Test libfcache_cache_initialize_with_flags with a flat index
 	 */
-	result = libfcache_cache_initialize(
+	result = libfcache_cache_initialize_with_flags(
 	          &cache,
 	          16,
+	          LIBFCACHE_CACHE_FLAG_FLAT_INDEX,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -340,91 +485,83 @@ int fcache_test_cache_empty(
 	 "error",
 	 error );
 
-	/* Test cache empty
-	 */
-	result = libfcache_cache_empty(
+	for( cache_entry_index = 0;
+	     cache_entry_index <= 16;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
 	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfcache_cache_empty(
-	          NULL,
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          16 * 512,
+	          0,
+	          &cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libfcache_cache_free(
-	          &cache,
-	          NULL );
+	result = libfcache_cache_resize(
+	          cache,
+	          8,
+	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache",
-	 cache );
-
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( cache != NULL )
-	{
-		libfcache_cache_free(
-		 &cache,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libfcache_cache_clone function
- * Returns 1 if successful or 0 if not
- */
-int fcache_test_cache_clone(
-     void )
-{
-	libcerror_error_t *error             = NULL;
-	libfcache_cache_t *destination_cache = NULL;
-	libfcache_cache_t *source_cache      = NULL;
-	int result                           = 0;
-
-	/* Initialize test
-	 */
-	result = libfcache_cache_initialize(
-	          &source_cache,
-	          16,
+	result = libfcache_cache_empty(
+	          cache,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -432,36 +569,29 @@ int fcache_test_cache_clone(
 	 result,
 	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "source_cache",
-	 source_cache );
-
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfcache_cache_clone(
-	          &destination_cache,
-	          source_cache,
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          16 * 512,
+	          0,
+	          &cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "destination_cache",
-	 destination_cache );
+	 0 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = libfcache_cache_free(
-	          &destination_cache,
+	          &cache,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -470,16 +600,19 @@ int fcache_test_cache_clone(
 	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
-	 "destination_cache",
-	 destination_cache );
+	 "cache",
+	 cache );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfcache_cache_clone(
-	          &destination_cache,
-	          NULL,
+	/* Test libfcache_cache_initialize_with_flags with CLOCK replacement
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -487,139 +620,159 @@ int fcache_test_cache_clone(
 	 result,
 	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "destination_cache",
-	 destination_cache );
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	for( cache_entry_index = 0;
+	     cache_entry_index < 4;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Reference the values at offsets 0 and 512 so that the value at offset 1024 is replaced
 	 */
-	result = libfcache_cache_clone(
-	          NULL,
-	          source_cache,
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	destination_cache = (libfcache_cache_t *) 0x12345678UL;
-
-	result = libfcache_cache_clone(
-	          &destination_cache,
-	          source_cache,
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
 	          &error );
 
-	destination_cache = NULL;
-
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          4 * 512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
 
-#if defined( HAVE_FCACHE_TEST_MEMORY )
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* Test libfcache_cache_clone with malloc failing
-	 */
-	fcache_test_malloc_attempts_before_fail = 0;
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libfcache_cache_clone(
-	          &destination_cache,
-	          source_cache,
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
 	          &error );
 
-	if( fcache_test_malloc_attempts_before_fail != -1 )
-	{
-		fcache_test_malloc_attempts_before_fail = -1;
-
-		if( destination_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &destination_cache,
-			 NULL );
-		}
-	}
-	else
-	{
-		FCACHE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FCACHE_TEST_ASSERT_IS_NULL(
-		 "destination_cache",
-		 destination_cache );
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FCACHE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          2 * 512,
+	          0,
+	          &cache_value,
+	          &error );
 
-		libcerror_error_free(
-		 &error );
-	}
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Test libfcache_cache_clone with memcpy failing
-	 */
-	fcache_test_memcpy_attempts_before_fail = 0;
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libfcache_cache_clone(
-	          &destination_cache,
-	          source_cache,
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          4 * 512,
+	          0,
+	          &cache_value,
 	          &error );
 
-	if( fcache_test_memcpy_attempts_before_fail != -1 )
-	{
-		fcache_test_memcpy_attempts_before_fail = -1;
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		if( destination_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &destination_cache,
-			 NULL );
-		}
-	}
-	else
-	{
-		FCACHE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FCACHE_TEST_ASSERT_IS_NULL(
-		 "destination_cache",
-		 destination_cache );
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
 
-		FCACHE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
 	result = libfcache_cache_free(
-	          &source_cache,
+	          &cache,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -628,51 +781,19 @@ int fcache_test_cache_clone(
 	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
-	 "source_cache",
-	 source_cache );
+	 "cache",
+	 cache );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( destination_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &destination_cache,
-		 NULL );
-	}
-	if( source_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &source_cache,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libfcache_cache_resize function
- * Returns 1 if successful or 0 if not
- */
-int fcache_test_cache_resize(
-     void )
-{
-	libfcache_cache_t *cache = NULL;
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Initialize test
+	/* Test libfcache_cache_initialize_with_flags with 2Q replacement
 	 */
-	result = libfcache_cache_initialize(
+	result = libfcache_cache_initialize_with_flags(
 	          &cache,
-	          16,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -688,11 +809,56 @@ int fcache_test_cache_resize(
 	 "error",
 	 error );
 
-	/* Test cache resize
+	for( cache_entry_index = 0;
+	     cache_entry_index <= 4;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The value at offset 0 was evicted, reading it again makes it part of the main queue
 	 */
-	result = libfcache_cache_resize(
+	result = libfcache_cache_get_value_by_identifier(
 	          cache,
-	          32,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -704,11 +870,8479 @@ int fcache_test_cache_resize(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* A scan of values that are read once does not evict the value at offset 0
 	 */
-	result = libfcache_cache_resize(
+	for( cache_entry_index = 16;
+	     cache_entry_index < 32;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          16 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          31 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfcache_cache_initialize_with_flags with S3-FIFO replacement
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_S3_FIFO_REPLACEMENT,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 0;
+	     cache_entry_index <= 4;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The value at offset 0 was evicted, reading it again inserts it in the main queue
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A scan of values that are read once does not evict the value at offset 0
+	 */
+	for( cache_entry_index = 16;
+	     cache_entry_index < 32;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          16 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          31 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfcache_cache_initialize_with_flags with GreedyDual-Size-Frequency replacement
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 0;
+	     cache_entry_index <= 4;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier_with_size(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          4096,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          4 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfcache_cache_initialize_with_flags with preallocated cache values
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_PREALLOCATE_VALUES,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 0;
+	     cache_entry_index <= 4;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          4 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_empty(
+	          cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          4 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 0;
+	     cache_entry_index < 8;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfcache_cache_initialize_with_flags with frequency admission
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 0;
+	     cache_entry_index < 4;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < 12;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) ( cache_entry_index % 4 ) * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A scan of values that are read once only replaces the value in the admission window
+	 */
+	for( cache_entry_index = 16;
+	     cache_entry_index < 32;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          3 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value that is read more frequently than the LRU value is admitted
+	 */
+	for( cache_entry_index = 0;
+	     cache_entry_index < 8;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          40 * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          40 * 512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          40 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          2 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          31 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          16,
+	          0xff,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          16,
+	          LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT | LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_initialize_with_policy function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_initialize_with_policy(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_t *destination_cache = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_initialize_with_policy(
+	          &cache,
+	          2,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_cache_policy_clear,
+	          &fcache_test_cache_policy_resize,
+	          &fcache_test_cache_policy_insert_slot,
+	          &fcache_test_cache_policy_reference_slot,
+	          &fcache_test_cache_policy_remove_slot,
+	          &fcache_test_cache_policy_get_victim_slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          1,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The test policy replaces the most recently inserted value
+	 */
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          2,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_policy_number_of_references",
+	 fcache_test_cache_policy_number_of_references,
+	 1 );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          1,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          2,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_policy_number_of_references",
+	 fcache_test_cache_policy_number_of_references,
+	 2 );
+
+	/* A policy without a clone policy data function cannot be cloned
+	 */
+	result = libfcache_cache_clone(
+	          &destination_cache,
+	          cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "destination_cache",
+	 destination_cache );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_initialize_with_policy(
+	          NULL,
+	          2,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_cache_policy_clear,
+	          &fcache_test_cache_policy_resize,
+	          &fcache_test_cache_policy_insert_slot,
+	          &fcache_test_cache_policy_reference_slot,
+	          &fcache_test_cache_policy_remove_slot,
+	          &fcache_test_cache_policy_get_victim_slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache = (libfcache_cache_t *) 0x12345678UL;
+
+	result = libfcache_cache_initialize_with_policy(
+	          &cache,
+	          2,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_cache_policy_clear,
+	          &fcache_test_cache_policy_resize,
+	          &fcache_test_cache_policy_insert_slot,
+	          &fcache_test_cache_policy_reference_slot,
+	          &fcache_test_cache_policy_remove_slot,
+	          &fcache_test_cache_policy_get_victim_slot,
+	          &error );
+
+	cache = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_initialize_with_policy(
+	          &cache,
+	          2,
+	          LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_cache_policy_clear,
+	          &fcache_test_cache_policy_resize,
+	          &fcache_test_cache_policy_insert_slot,
+	          &fcache_test_cache_policy_reference_slot,
+	          &fcache_test_cache_policy_remove_slot,
+	          &fcache_test_cache_policy_get_victim_slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_initialize_with_policy(
+	          &cache,
+	          2,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_cache_policy_clear,
+	          &fcache_test_cache_policy_resize,
+	          &fcache_test_cache_policy_insert_slot,
+	          &fcache_test_cache_policy_reference_slot,
+	          &fcache_test_cache_policy_remove_slot,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &destination_cache,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_empty(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	libcerror_error_t *error             = NULL;
+	intptr_t *value                      = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test cache empty
+	 */
+	result = libfcache_cache_empty(
+	          cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test cache empty with a pinned cache value
+	 */
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          7 * 512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_acquire_value_by_identifier(
+	          cache,
+	          0,
+	          7 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_empty(
+	          cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the pinned cache value remains usable
+	 */
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          &value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 value,
+	 (intptr_t *) value_data );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_release_value(
+	          cache,
+	          cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_empty(
+	          cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_empty(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          NULL );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_clone(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *destination_cache = NULL;
+	libfcache_cache_t *source_cache      = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &source_cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "source_cache",
+	 source_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_clone(
+	          &destination_cache,
+	          source_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_cache",
+	 destination_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &destination_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "destination_cache",
+	 destination_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_clone(
+	          &destination_cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "destination_cache",
+	 destination_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_clone(
+	          NULL,
+	          source_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_cache = (libfcache_cache_t *) 0x12345678UL;
+
+	result = libfcache_cache_clone(
+	          &destination_cache,
+	          source_cache,
+	          &error );
+
+	destination_cache = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+
+	/* Test libfcache_cache_clone with malloc failing
+	 */
+	fcache_test_malloc_attempts_before_fail = 0;
+
+	result = libfcache_cache_clone(
+	          &destination_cache,
+	          source_cache,
+	          &error );
+
+	if( fcache_test_malloc_attempts_before_fail != -1 )
+	{
+		fcache_test_malloc_attempts_before_fail = -1;
+
+		if( destination_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &destination_cache,
+			 NULL );
+		}
+	}
+	else
+	{
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "destination_cache",
+		 destination_cache );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+
+	/* Test libfcache_cache_clone with memcpy failing
+	 */
+	fcache_test_memcpy_attempts_before_fail = 0;
+
+	result = libfcache_cache_clone(
+	          &destination_cache,
+	          source_cache,
+	          &error );
+
+	if( fcache_test_memcpy_attempts_before_fail != -1 )
+	{
+		fcache_test_memcpy_attempts_before_fail = -1;
+
+		if( destination_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &destination_cache,
+			 NULL );
+		}
+	}
+	else
+	{
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "destination_cache",
+		 destination_cache );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &source_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "source_cache",
+	 source_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &destination_cache,
+		 NULL );
+	}
+	if( source_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &source_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_resize(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	libcerror_error_t *error             = NULL;
+	intptr_t *value                      = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test cache resize
+	 */
+	result = libfcache_cache_resize(
+	          cache,
+	          32,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test cache resize with a pinned cache value
+	 */
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          7,
+	          0,
+	          7 * 512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_acquire_value_by_identifier(
+	          cache,
+	          0,
+	          7 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the pinned cache value remains usable
+	 */
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          &value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 value,
+	 (intptr_t *) value_data );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_release_value(
+	          cache,
+	          cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_resize(
+	          NULL,
+	          32,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_resize(
+	          cache,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          NULL );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_number_of_entries(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libfcache_cache_t *cache = NULL;
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_number_of_entries(
+	          cache,
+	          &number_of_entries,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 16 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_number_of_entries(
+	          cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          NULL );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_number_of_cache_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_number_of_cache_values(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libfcache_cache_t *cache   = NULL;
+	libcerror_error_t *error   = NULL;
+	int number_of_cache_values = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_number_of_cache_values(
+	          cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_get_number_of_cache_values(
+	          NULL,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_number_of_cache_values(
+	          cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          NULL );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_maximum_cache_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libfcache_cache_t *cache    = NULL;
+	size64_t maximum_cache_size = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_maximum_cache_size(
+	          cache,
+	          &maximum_cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_cache_size",
+	 maximum_cache_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_get_maximum_cache_size(
+	          NULL,
+	          &maximum_cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_maximum_cache_size(
+	          cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_maximum_cache_size(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	size64_t cache_size                  = 0;
+	size64_t maximum_cache_size          = 0;
+	int cache_entry_index                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 0;
+	     cache_entry_index < 4;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier_with_size(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          32,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfcache_cache_set_maximum_cache_size(
+	          cache,
+	          64,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_maximum_cache_size(
+	          cache,
+	          &maximum_cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_cache_size",
+	 maximum_cache_size,
+	 (uint64_t) 64 );
+
+	/* The least recently used values are cleared until the cache size fits
+	 */
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 64 );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          3 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_maximum_cache_size(
+	          NULL,
+	          64,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_cache_size(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libfcache_cache_t *cache = NULL;
+	size64_t cache_size      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 0 );
+
+	result = libfcache_cache_set_value_by_identifier_with_size(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          100,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 100 );
+
+	result = libfcache_cache_clear_value_by_index(
+	          cache,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_get_cache_size(
+	          NULL,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_time_to_live function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_time_to_live(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfcache_cache_t *cache = NULL;
+	int64_t time_to_live     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_time_to_live(
+	          cache,
+	          &time_to_live,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT64(
+	 "time_to_live",
+	 time_to_live,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_get_time_to_live(
+	          NULL,
+	          &time_to_live,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_time_to_live(
+	          cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_cache_set_time_to_live function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_time_to_live(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int64_t expiry_timestamp             = 0;
+	int64_t time_to_live                 = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_set_time_to_live(
+	          cache,
+	          (int64_t) 0x7fffffffffffffffLL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_time_to_live(
+	          cache,
+	          &time_to_live,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT64(
+	 "time_to_live",
+	 time_to_live,
+	 (int64_t) 0x7fffffffffffffffLL );
+
+	/* The expiry timestamp of a value that is set is capped at the maximum timestamp
+	 */
+	result = libfcache_cache_set_value_by_identifier_with_size(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          32,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	result = libfcache_cache_value_get_expiry_timestamp(
+	          cache_value,
+	          &expiry_timestamp,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT64(
+	 "expiry_timestamp",
+	 expiry_timestamp,
+	 (int64_t) 0x7fffffffffffffffLL );
+
+	/* The time-to-live does not apply to a value that is set before
+	 */
+	result = libfcache_cache_set_time_to_live(
+	          cache,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier_with_size(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          32,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	result = libfcache_cache_value_get_expiry_timestamp(
+	          cache_value,
+	          &expiry_timestamp,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT64(
+	 "expiry_timestamp",
+	 expiry_timestamp,
+	 (int64_t) 0 );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_time_to_live(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_time_to_live(
+	          cache,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* Tests the libfcache_cache_clear_value_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_clear_value_by_index(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libfcache_cache_t *cache = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_clear_value_by_index(
+	          cache,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_clear_value_by_index(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_clear_value_by_index(
+	          cache,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_invalidate_file function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_invalidate_file(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          1,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_invalidate_file(
+	          cache,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          1,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test invalidating a file index without cache values
+	 */
+	result = libfcache_cache_invalidate_file(
+	          cache,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_invalidate_file(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_invalidate_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_invalidate_range(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          1536,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          1,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_invalidate_range(
+	          cache,
+	          0,
+	          512,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          1536,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          1,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test invalidating an empty range
+	 */
+	result = libfcache_cache_invalidate_range(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_invalidate_range(
+	          NULL,
+	          0,
+	          0,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_invalidate_range(
+	          cache,
+	          0,
+	          -1,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_invalidate_range(
+	          cache,
+	          0,
+	          1,
+	          (size64_t) INT64_MAX,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_iterate_values_in_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_iterate_values_in_range(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libfcache_cache_t *cache = NULL;
+	int number_of_values     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          1536,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          1,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	fcache_test_cache_iterate_last_offset              = -1;
+	fcache_test_cache_iterate_maximum_number_of_values = 0;
+	number_of_values                                   = 0;
+
+	result = libfcache_cache_iterate_values_in_range(
+	          cache,
+	          0,
+	          0,
+	          2048,
+	          &fcache_test_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 4 );
+
+	fcache_test_cache_iterate_last_offset              = -1;
+	fcache_test_cache_iterate_maximum_number_of_values = 0;
+	number_of_values                                   = 0;
+
+	result = libfcache_cache_iterate_values_in_range(
+	          cache,
+	          0,
+	          512,
+	          1024,
+	          &fcache_test_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	fcache_test_cache_iterate_last_offset              = -1;
+	fcache_test_cache_iterate_maximum_number_of_values = 0;
+	number_of_values                                   = 0;
+
+	result = libfcache_cache_iterate_values_in_range(
+	          cache,
+	          0,
+	          2048,
+	          512,
+	          &fcache_test_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 0 );
+
+	/* Test stopping the iteration
+	 */
+	fcache_test_cache_iterate_last_offset              = -1;
+	fcache_test_cache_iterate_maximum_number_of_values = 2;
+	number_of_values                                   = 0;
+
+	result = libfcache_cache_iterate_values_in_range(
+	          cache,
+	          0,
+	          0,
+	          2048,
+	          &fcache_test_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	fcache_test_cache_iterate_maximum_number_of_values = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_iterate_values_in_range(
+	          NULL,
+	          0,
+	          0,
+	          1024,
+	          &fcache_test_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_iterate_values_in_range(
+	          cache,
+	          0,
+	          -1,
+	          1024,
+	          &fcache_test_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_iterate_values_in_range(
+	          cache,
+	          0,
+	          1,
+	          (size64_t) INT64_MAX,
+	          &fcache_test_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_iterate_values_in_range(
+	          cache,
+	          0,
+	          0,
+	          1024,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_value_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_value_by_identifier(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = 0;
+	int cache_entry_index                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	/* Test with an identifier that is not in the cache
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an identifier is no longer retrievable after its cache value was reused
+	 */
+	for( cache_entry_index = 1;
+	     cache_entry_index <= 16;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          16 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	cache_value = NULL;
+
+	result = libfcache_cache_get_value_by_identifier(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a cache that uses a hash table
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &cache,
+	          128,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 0;
+	     cache_entry_index <= 128;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          128 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_values_by_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_values_by_identifiers(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libfcache_cache_value_t *cache_values[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	libfcache_cache_t *cache = NULL;
+	off64_t offsets[ 3 ]     = { 0, 1024, 512 };
+	int64_t timestamps[ 3 ]  = { 0, 0, 0 };
+	uint8_t flags[ 3 ]       = { 0, LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION, 0 };
+	int file_indexes[ 3 ]    = { 0, 0, 0 };
+	int number_of_hits       = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	for( test_number = 0;
+	     test_number < 3;
+	     test_number++ )
+	{
+		/* Initialize test
+		 */
+		result = libfcache_cache_initialize_with_flags(
+		          &cache,
+		          16,
+		          flags[ test_number ],
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The third test uses values that can expire
+		 */
+		if( test_number == 2 )
+		{
+			result = libfcache_cache_set_time_to_live(
+			          cache,
+			          (int64_t) 0x7fffffffffffffffLL,
+			          &error );
+
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          0,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libfcache_cache_get_values_by_identifiers(
+		          cache,
+		          3,
+		          file_indexes,
+		          offsets,
+		          timestamps,
+		          cache_values,
+		          &number_of_hits,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_hits",
+		 number_of_hits,
+		 2 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "cache_values[ 0 ]",
+		 cache_values[ 0 ] );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "cache_values[ 1 ]",
+		 cache_values[ 1 ] );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "cache_values[ 2 ]",
+		 cache_values[ 2 ] );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libfcache_cache_free(
+		          &cache,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with no identifiers
+	 */
+	number_of_hits = -1;
+
+	result = libfcache_cache_get_values_by_identifiers(
+	          cache,
+	          0,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          cache_values,
+	          &number_of_hits,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_get_values_by_identifiers(
+	          NULL,
+	          3,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          cache_values,
+	          &number_of_hits,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_values_by_identifiers(
+	          cache,
+	          -1,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          cache_values,
+	          &number_of_hits,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_values_by_identifiers(
+	          cache,
+	          3,
+	          NULL,
+	          offsets,
+	          timestamps,
+	          cache_values,
+	          &number_of_hits,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          NULL,
+	          timestamps,
+	          cache_values,
+	          &number_of_hits,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          offsets,
+	          NULL,
+	          cache_values,
+	          &number_of_hits,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          NULL,
+	          &number_of_hits,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          cache_values,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The number of times the test load value function was called
+ */
+int fcache_test_cache_load_value_number_of_calls = 0;
+
+/* Test load value function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_load_value(
+     intptr_t *load_data,
+     int file_index FCACHE_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int64_t timestamp FCACHE_TEST_ATTRIBUTE_UNUSED,
+     intptr_t **value,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fcache_test_cache_load_value";
+
+	FCACHE_TEST_UNREFERENCED_PARAMETER( file_index )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( offset )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( timestamp )
+
+	fcache_test_cache_load_value_number_of_calls++;
+
+	if( load_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing load data.",
+		 function );
+
+		return( -1 );
+	}
+	*value      = load_data;
+	*value_size = 16;
+
+	return( 1 );
+}
+
+/* The value data set by the test load value with set function
+ */
+uint8_t fcache_test_cache_load_value_with_set_data[ 16 ];
+
+/* Test load value function that sets the value in the cache while it is loaded
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_load_value_with_set(
+     intptr_t *load_data,
+     int file_index,
+     off64_t offset,
+     int64_t timestamp,
+     intptr_t **value,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fcache_test_cache_load_value_with_set";
+
+	fcache_test_cache_load_value_number_of_calls++;
+
+	if( libfcache_cache_set_value_by_identifier(
+	     (libfcache_cache_t *) load_data,
+	     file_index,
+	     offset,
+	     timestamp,
+	     (intptr_t *) fcache_test_cache_load_value_with_set_data,
+	     &fcache_test_cache_value_free_function,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value.",
+		 function );
+
+		return( -1 );
+	}
+	*value      = load_data;
+	*value_size = 16;
+
+	return( 1 );
+}
+
+/* Tests the libfcache_cache_get_or_load_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_or_load_value(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	intptr_t *value                      = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fcache_test_cache_load_value_number_of_calls = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &fcache_test_cache_load_value,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_load_value_number_of_calls",
+	 fcache_test_cache_load_value_number_of_calls,
+	 1 );
+
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          &value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 value,
+	 (intptr_t *) value_data );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a value that is already in the cache
+	 */
+	cache_value = NULL;
+
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &fcache_test_cache_load_value,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_load_value_number_of_calls",
+	 fcache_test_cache_load_value_number_of_calls,
+	 1 );
+
+	/* Test with a value that is set in the cache while it is loaded
+	 */
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          2048,
+	          0,
+	          &fcache_test_cache_load_value_with_set,
+	          (intptr_t *) cache,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_load_value_number_of_calls",
+	 fcache_test_cache_load_value_number_of_calls,
+	 2 );
+
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          &value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 value,
+	 (intptr_t *) fcache_test_cache_load_value_with_set_data );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_get_or_load_value(
+	          NULL,
+	          0,
+	          512,
+	          0,
+	          &fcache_test_cache_load_value,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          NULL,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &fcache_test_cache_load_value,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfcache_cache_get_or_load_value with load value failing
+	 */
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          &fcache_test_cache_load_value,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The value that failed to load is not stored in the cache
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The load of a value that failed to load is retried
+	 */
+	fcache_test_cache_load_value_number_of_calls = 0;
+
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          &fcache_test_cache_load_value,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_load_value_number_of_calls",
+	 fcache_test_cache_load_value_number_of_calls,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_get_or_load_value function with a loaded value that cannot be set
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_or_load_value_set_failure(
+     void )
+{
+	uint8_t pinned_value_data[ 16 ];
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                    = NULL;
+	libfcache_cache_t *cache                    = NULL;
+	libfcache_cache_value_t *cache_value        = NULL;
+	libfcache_cache_value_t *pinned_cache_value = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) pinned_value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_acquire_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &pinned_cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the loaded value is freed when the only cache entry is pinned
+	 */
+	fcache_test_cache_load_value_number_of_calls          = 0;
+	fcache_test_cache_value_free_function_number_of_calls = 0;
+
+	result = libfcache_cache_get_or_load_value(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &fcache_test_cache_load_value,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_load_value_number_of_calls",
+	 fcache_test_cache_load_value_number_of_calls,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_value_free_function_number_of_calls",
+	 fcache_test_cache_value_free_function_number_of_calls,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_release_value(
+	          cache,
+	          pinned_cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libfcache_internal_cache_get_value_by_identifier_for_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_internal_cache_get_value_by_identifier_for_read(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	uint8_t requires_write               = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* The most recently used value can be retrieved without modifying the cache
+	 */
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "requires_write",
+	 requires_write,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	/* A value that is not the most recently used value is returned
+	 * and its promotion is recorded in the hit buffers
+	 */
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "requires_write",
+	 requires_write,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A miss does not modify the cache
+	 */
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "requires_write",
+	 requires_write,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	/* Test error cases
+	 */
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          0,
+	          0,
+	          NULL,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a replacement policy, where every hit is referenced in the policy
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "requires_write",
+	 requires_write,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "requires_write",
+	 requires_write,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with frequency admission, where every lookup updates the frequency sketch
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "requires_write",
+	 requires_write,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_internal_cache_apply_hit_buffers function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_internal_cache_apply_hit_buffers(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	uint8_t requires_write               = 0;
+	int cache_entry_index                = 0;
+	int first_cache_entry_index          = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_internal_cache_index_get_slot_by_identifier(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          0,
+	          0,
+	          &cache_entry_index,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Record a hit on the least recently used value
+	 */
+	result = libfcache_internal_cache_get_value_by_identifier_for_read(
+	          (libfcache_internal_cache_t *) cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &requires_write,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_slot_queues_get_first_slot(
+	          ( (libfcache_internal_cache_t *) cache )->used_slots,
+	          LIBFCACHE_CACHE_QUEUE_USED,
+	          &first_cache_entry_index,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "first_cache_entry_index",
+	 first_cache_entry_index,
+	 cache_entry_index );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_internal_cache_apply_hit_buffers(
+	          (libfcache_internal_cache_t *) cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_slot_queues_get_first_slot(
+	          ( (libfcache_internal_cache_t *) cache )->used_slots,
+	          LIBFCACHE_CACHE_QUEUE_USED,
+	          &first_cache_entry_index,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "first_cache_entry_index",
+	 first_cache_entry_index,
+	 cache_entry_index );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A hit on a slot that is not in use is ignored
+	 */
+	result = libfcache_hit_buffers_append_slot(
+	          ( (libfcache_internal_cache_t *) cache )->hit_buffers,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_internal_cache_apply_hit_buffers(
+	          (libfcache_internal_cache_t *) cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_slot_queues_get_first_slot(
+	          ( (libfcache_internal_cache_t *) cache )->used_slots,
+	          LIBFCACHE_CACHE_QUEUE_USED,
+	          &first_cache_entry_index,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "first_cache_entry_index",
+	 first_cache_entry_index,
+	 cache_entry_index );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_internal_cache_apply_hit_buffers(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* Tests the libfcache_cache_get_value_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_value_by_index(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_get_value_by_index(
+	          cache,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	/* Test error cases
+	 */
+	cache_value = NULL;
+
+	result = libfcache_cache_get_value_by_index(
+	          NULL,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_value_by_index(
+	          cache,
+	          -1,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_get_value_by_index(
+	          cache,
+	          0,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_identifier(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_value_by_identifier(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          NULL,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+
+	/* Test libfcache_cache_value_clear with malloc failing
+	 */
+	fcache_test_malloc_attempts_before_fail = 0;
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	if( fcache_test_malloc_attempts_before_fail != -1 )
+	{
+		fcache_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_identifier function with an identifier that is already stored
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_identifier_replace(
+     void )
+{
+	uint8_t first_value_data[ 16 ];
+	uint8_t second_value_data[ 16 ];
+
+	int maximum_cache_entries[ 3 ] = { 16, 16, 64 };
+	uint8_t flags[ 3 ]             = { 0, LIBFCACHE_CACHE_FLAG_FLAT_INDEX, 0 };
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	intptr_t *value                      = NULL;
+	int index_type                       = 0;
+	int result                           = 0;
+
+	/* Test with a linear table, a flat table and a hash table index
+	 */
+	for( index_type = 0;
+	     index_type < 3;
+	     index_type++ )
+	{
+		result = libfcache_cache_initialize_with_flags(
+		          &cache,
+		          maximum_cache_entries[ index_type ],
+		          flags[ index_type ],
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          100,
+		          0,
+		          (intptr_t *) first_value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          100,
+		          0,
+		          (intptr_t *) second_value_data,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test that the most recently stored value is retrieved
+		 */
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          100,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_value_get_value(
+		          cache_value,
+		          &value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+		 "value",
+		 value,
+		 (intptr_t *) second_value_data );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_free(
+		          &cache,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_identifier function with a cache entry set by index
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_identifier_unused(
+     void )
+{
+	uint8_t value_data[ 4 ][ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	intptr_t *value                      = NULL;
+	int value_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Set the value of the last cache entry by index
+	 */
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          3,
+	          0,
+	          3 * 512,
+	          0,
+	          (intptr_t *) value_data[ 3 ],
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the values set by identifier use the unused cache entries
+	 */
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) value_index * 512,
+		          0,
+		          (intptr_t *) value_data[ value_index ],
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) value_index * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_value_get_value(
+		          cache_value,
+		          &value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+		 "value",
+		 value,
+		 (intptr_t *) value_data[ value_index ] );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_index(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_value_by_index(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          NULL,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+
+	/* Test libfcache_cache_value_clear with malloc failing
+	 */
+	fcache_test_malloc_attempts_before_fail = 0;
+
+	result = libfcache_cache_set_value_by_index(
+	          cache,
+	          1,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	if( fcache_test_malloc_attempts_before_fail != -1 )
+	{
+		fcache_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_identifier_with_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_identifier_with_size(
+     void )
+{
+	uint8_t cache_flags[ 6 ] = {
+		0,
+		LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT,
+		LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT,
+		LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION,
+		LIBFCACHE_CACHE_FLAG_S3_FIFO_REPLACEMENT,
+		LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT };
+
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	size64_t cache_size                  = 0;
+	int cache_entry_index                = 0;
+	int flags_index                      = 0;
+	int number_of_cached_values          = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	for( flags_index = 0;
+	     flags_index < 6;
+	     flags_index++ )
+	{
+		result = libfcache_cache_initialize_with_flags(
+		          &cache,
+		          8,
+		          cache_flags[ flags_index ],
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_set_maximum_cache_size(
+		          cache,
+		          100,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( cache_entry_index = 0;
+		     cache_entry_index < 4;
+		     cache_entry_index++ )
+		{
+			result = libfcache_cache_set_value_by_identifier_with_size(
+			          cache,
+			          0,
+			          (off64_t) cache_entry_index * 512,
+			          0,
+			          (intptr_t *) value_data,
+			          40,
+			          &fcache_test_cache_value_free_function,
+			          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+			          &error );
+
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Values are cleared until the cache size fits
+		 */
+		result = libfcache_cache_get_cache_size(
+		          cache,
+		          &cache_size,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FCACHE_TEST_ASSERT_EQUAL_UINT64(
+		 "cache_size",
+		 cache_size,
+		 (uint64_t) 80 );
+
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          3 * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_cached_values = 0;
+
+		for( cache_entry_index = 0;
+		     cache_entry_index < 4;
+		     cache_entry_index++ )
+		{
+			result = libfcache_cache_get_value_by_identifier(
+			          cache,
+			          0,
+			          (off64_t) cache_entry_index * 512,
+			          0,
+			          &cache_value,
+			          &error );
+
+			FCACHE_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			number_of_cached_values += result;
+		}
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_cached_values",
+		 number_of_cached_values,
+		 2 );
+
+		/* A value that exceeds the maximum cache size is retained
+		 */
+		result = libfcache_cache_set_value_by_identifier_with_size(
+		          cache,
+		          0,
+		          4 * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          200,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_get_cache_size(
+		          cache,
+		          &cache_size,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FCACHE_TEST_ASSERT_EQUAL_UINT64(
+		 "cache_size",
+		 cache_size,
+		 (uint64_t) 200 );
+
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          4 * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_free(
+		          &cache,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_value_by_identifier_with_size(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          40,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_index_with_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_index_with_size(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libfcache_cache_t *cache = NULL;
+	size64_t cache_size      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_maximum_cache_size(
+	          cache,
+	          100,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_set_value_by_index_with_size(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          60,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 60 );
+
+	result = libfcache_cache_set_value_by_index_with_size(
+	          cache,
+	          1,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          60,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value of cache entry 0 is cleared since the cache size exceeds its maximum
+	 */
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 60 );
+
+	/* Replacing a value accounts for the size of the replaced value
+	 */
+	result = libfcache_cache_set_value_by_index_with_size(
+	          cache,
+	          1,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          20,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 20 );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_value_by_index_with_size(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          60,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_identifier_with_cost function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_identifier_with_cost(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int cache_entry_index                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          4,
+	          LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* The value at offset 0 is expensive to reload
+	 */
+	result = libfcache_cache_set_value_by_identifier_with_cost(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          4096,
+	          1000,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( cache_entry_index = 1;
+	     cache_entry_index < 8;
+	     cache_entry_index++ )
+	{
+		result = libfcache_cache_set_value_by_identifier_with_cost(
+		          cache,
+		          0,
+		          (off64_t) cache_entry_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          4096,
+		          1,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The values that are cheap to reload are replaced before the value at offset 0
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          7 * 512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_value_by_identifier_with_cost(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          4096,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_value_by_index_with_cost function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_value_by_index_with_cost(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize_with_flags(
+	          &cache,
+	          2,
+	          LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_set_value_by_index_with_cost(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          4096,
+	          1000,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_index_with_cost(
+	          cache,
+	          1,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          4096,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value that is cheap to reload is replaced
+	 */
+	result = libfcache_cache_set_value_by_identifier_with_cost(
+	          cache,
+	          0,
+	          2 * 512,
+	          0,
+	          (intptr_t *) value_data,
+	          4096,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_value_by_index_with_cost(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          4096,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_value_by_index_with_cost(
+	          cache,
+	          -1,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          4096,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_cache_set_values_by_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_set_values_by_identifiers(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	intptr_t *values[ 3 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	size64_t cache_size                  = 0;
+	off64_t offsets[ 3 ]                 = { 0, 512, 1024 };
+	int64_t timestamps[ 3 ]              = { 0, 0, 0 };
+	size_t value_sizes[ 3 ]              = { 16, 16, 16 };
+	int file_indexes[ 3 ]                = { 0, 1, 0 };
+	int number_of_cache_values           = 0;
+	int result                           = 0;
+
+	values[ 0 ] = (intptr_t *) value_data;
+	values[ 1 ] = (intptr_t *) value_data;
+	values[ 2 ] = (intptr_t *) value_data;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_cache_set_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          values,
+	          value_sizes,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_number_of_cache_values(
+	          cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 3 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 (uint64_t) cache_size,
+	 (uint64_t) 48 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          1,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with values that have no size
+	 */
+	offsets[ 0 ] = 2048;
+	offsets[ 1 ] = 2560;
+	offsets[ 2 ] = 3072;
+
+	result = libfcache_cache_set_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          values,
 	          NULL,
-	          32,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_number_of_cache_values(
+	          cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 6 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with no values
+	 */
+	result = libfcache_cache_set_values_by_identifiers(
+	          cache,
+	          0,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          values,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_cache_set_values_by_identifiers(
+	          NULL,
+	          3,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          values,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_values_by_identifiers(
+	          cache,
+	          -1,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          values,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_values_by_identifiers(
+	          cache,
+	          3,
+	          NULL,
+	          offsets,
+	          timestamps,
+	          values,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          NULL,
+	          timestamps,
+	          values,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_set_values_by_identifiers(
+	          cache,
+	          3,
+	          file_indexes,
+	          offsets,
+	          NULL,
+	          values,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -723,9 +9357,16 @@ int fcache_test_cache_resize(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcache_cache_resize(
+	result = libfcache_cache_set_values_by_identifiers(
 	          cache,
-	          -1,
+	          3,
+	          file_indexes,
+	          offsets,
+	          timestamps,
+	          NULL,
+	          NULL,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -744,7 +9385,7 @@ int fcache_test_cache_resize(
 	 */
 	result = libfcache_cache_free(
 	          &cache,
-	          NULL );
+	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -776,24 +9417,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcache_cache_get_number_of_entries function
+/* Tests the libfcache_cache_exchange_value_by_identifier function
  * Returns 1 if successful or 0 if not
  */
-int fcache_test_cache_get_number_of_entries(
+int fcache_test_cache_exchange_value_by_identifier(
      void )
 {
-	uint8_t value_data[ 16 ];
+	uint8_t value_data1[ 16 ];
+	uint8_t value_data2[ 16 ];
+	uint8_t value_data3[ 16 ];
 
-	libfcache_cache_t *cache = NULL;
-	libcerror_error_t *error = NULL;
-	int number_of_entries    = 0;
-	int result               = 0;
+	libcerror_error_t *error   = NULL;
+	libfcache_cache_t *cache   = NULL;
+	intptr_t *replaced_value   = NULL;
+	size_t replaced_value_size = 0;
+	int result                 = 0;
 
 	/* Initialize test
 	 */
 	result = libfcache_cache_initialize(
 	          &cache,
-	          16,
+	          1,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -809,15 +9453,20 @@ int fcache_test_cache_get_number_of_entries(
 	 "error",
 	 error );
 
-	result = libfcache_cache_set_value_by_index(
+	/* Test regular cases
+	 */
+	result = libfcache_cache_exchange_value_by_identifier(
 	          cache,
 	          0,
 	          0,
 	          0,
-	          0,
-	          (intptr_t *) value_data,
+	          (intptr_t *) value_data1,
+	          8,
+	          1,
 	          &fcache_test_cache_value_free_function,
 	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &replaced_value,
+	          &replaced_value_size,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -829,11 +9478,30 @@ int fcache_test_cache_get_number_of_entries(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "replaced_value",
+	 (intptr_t) replaced_value,
+	 (intptr_t) NULL );
+
+	FCACHE_TEST_ASSERT_EQUAL_SIZE(
+	 "replaced_value_size",
+	 replaced_value_size,
+	 (size_t) 0 );
+
+	/* The managed value of the cache entry that is reused is returned instead of freed
 	 */
-	result = libfcache_cache_get_number_of_entries(
+	result = libfcache_cache_exchange_value_by_identifier(
 	          cache,
-	          &number_of_entries,
+	          0,
+	          16,
+	          0,
+	          (intptr_t *) value_data2,
+	          16,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &replaced_value,
+	          &replaced_value_size,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -841,20 +9509,102 @@ int fcache_test_cache_get_number_of_entries(
 	 result,
 	 1 );
 
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "replaced_value",
+	 (intptr_t) replaced_value,
+	 (intptr_t) value_data1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_SIZE(
+	 "replaced_value_size",
+	 replaced_value_size,
+	 (size_t) 8 );
+
+	result = libfcache_cache_exchange_value_by_identifier(
+	          cache,
+	          0,
+	          32,
+	          0,
+	          (intptr_t *) value_data3,
+	          8,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_NON_MANAGED,
+	          &replaced_value,
+	          &replaced_value_size,
+	          &error );
+
 	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "number_of_entries",
-	 number_of_entries,
-	 16 );
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "replaced_value",
+	 (intptr_t) replaced_value,
+	 (intptr_t) value_data2 );
+
+	FCACHE_TEST_ASSERT_EQUAL_SIZE(
+	 "replaced_value_size",
+	 replaced_value_size,
+	 (size_t) 16 );
+
+	/* A value that is not managed by the cache is not returned
+	 */
+	result = libfcache_cache_exchange_value_by_identifier(
+	          cache,
+	          0,
+	          48,
+	          0,
+	          (intptr_t *) value_data1,
+	          8,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &replaced_value,
+	          &replaced_value_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "replaced_value",
+	 (intptr_t) replaced_value,
+	 (intptr_t) NULL );
+
+	FCACHE_TEST_ASSERT_EQUAL_SIZE(
+	 "replaced_value_size",
+	 replaced_value_size,
+	 (size_t) 0 );
+
 	/* Test error cases
 	 */
-	result = libfcache_cache_get_number_of_entries(
+	result = libfcache_cache_exchange_value_by_identifier(
 	          NULL,
-	          &number_of_entries,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data1,
+	          8,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &replaced_value,
+	          &replaced_value_size,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -869,8 +9619,43 @@ int fcache_test_cache_get_number_of_entries(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcache_cache_get_number_of_entries(
+	result = libfcache_cache_exchange_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data1,
+	          8,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          NULL,
+	          &replaced_value_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_cache_exchange_value_by_identifier(
 	          cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data1,
+	          8,
+	          1,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &replaced_value,
 	          NULL,
 	          &error );
 
@@ -890,7 +9675,7 @@ int fcache_test_cache_get_number_of_entries(
 	 */
 	result = libfcache_cache_free(
 	          &cache,
-	          NULL );
+	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -922,24 +9707,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcache_cache_get_number_of_cache_values function
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_cache_set_value_time_to_live_by_identifier function
  * Returns 1 if successful or 0 if not
  */
-int fcache_test_cache_get_number_of_cache_values(
+int fcache_test_cache_set_value_time_to_live_by_identifier(
      void )
 {
 	uint8_t value_data[ 16 ];
 
-	libfcache_cache_t *cache   = NULL;
-	libcerror_error_t *error   = NULL;
-	int number_of_cache_values = 0;
-	int result                 = 0;
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	size64_t cache_size                  = 0;
+	int result                           = 0;
 
 	/* Initialize test
 	 */
 	result = libfcache_cache_initialize(
 	          &cache,
-	          16,
+	          4,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -955,13 +9743,33 @@ int fcache_test_cache_get_number_of_cache_values(
 	 "error",
 	 error );
 
-	result = libfcache_cache_set_value_by_index(
+	result = libfcache_cache_set_value_by_identifier_with_size(
 	          cache,
 	          0,
 	          0,
 	          0,
+	          (intptr_t *) value_data,
+	          32,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier_with_size(
+	          cache,
+	          0,
+	          512,
 	          0,
 	          (intptr_t *) value_data,
+	          32,
 	          &fcache_test_cache_value_free_function,
 	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
@@ -977,9 +9785,12 @@ int fcache_test_cache_get_number_of_cache_values(
 
 	/* Test regular cases
 	 */
-	result = libfcache_cache_get_number_of_cache_values(
+	result = libfcache_cache_set_value_time_to_live_by_identifier(
 	          cache,
-	          &number_of_cache_values,
+	          0,
+	          0,
+	          0,
+	          (int64_t) 0x7fffffffffffffffLL,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -987,104 +9798,203 @@ int fcache_test_cache_get_number_of_cache_values(
 	 result,
 	 1 );
 
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value that has not expired is retrieved
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
 	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "number_of_cache_values",
-	 number_of_cache_values,
+	 "result",
+	 result,
 	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	/* An expired value is cleared and not retrieved
 	 */
-	result = libfcache_cache_get_number_of_cache_values(
-	          NULL,
-	          &number_of_cache_values,
+	result = libfcache_cache_value_set_expiry_timestamp(
+	          cache_value,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 32 );
+
+	/* Expired values are cleared when a value is set
+	 */
+	result = libfcache_cache_set_value_time_to_live_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (int64_t) 0x7fffffffffffffffLL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	result = libfcache_cache_value_set_expiry_timestamp(
+	          cache_value,
+	          1,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	( (libfcache_internal_cache_t *) cache )->next_expiry_timestamp = 1;
 
-	result = libfcache_cache_get_number_of_cache_values(
+	result = libfcache_cache_set_value_by_identifier_with_size(
 	          cache,
-	          NULL,
+	          0,
+	          1024,
+	          0,
+	          (intptr_t *) value_data,
+	          16,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libfcache_cache_free(
-	          &cache,
-	          NULL );
+	result = libfcache_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache",
-	 cache );
-
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) 16 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( cache != NULL )
-	{
-		libfcache_cache_free(
-		 &cache,
-		 NULL );
-	}
-	return( 0 );
-}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
 
-/* Tests the libfcache_cache_clear_value_by_index function
- * Returns 1 if successful or 0 if not
- */
-int fcache_test_cache_clear_value_by_index(
-     void )
-{
-	uint8_t value_data[ 16 ];
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	libcerror_error_t *error = NULL;
-	libfcache_cache_t *cache = NULL;
-	int result               = 0;
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
-	result = libfcache_cache_initialize(
-	          &cache,
-	          16,
+	result = libfcache_cache_get_value_by_identifier(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1092,23 +10002,18 @@ int fcache_test_cache_clear_value_by_index(
 	 result,
 	 1 );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "cache",
-	 cache );
-
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfcache_cache_set_value_by_index(
+	/* A time-to-live of 0 represents a value that does not expire
+	 */
+	result = libfcache_cache_set_value_time_to_live_by_identifier(
 	          cache,
 	          0,
+	          1024,
 	          0,
 	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          &fcache_test_cache_value_free_function,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1120,17 +10025,18 @@ int fcache_test_cache_clear_value_by_index(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfcache_cache_clear_value_by_index(
+	result = libfcache_cache_set_value_time_to_live_by_identifier(
 	          cache,
 	          0,
+	          2048,
+	          0,
+	          0,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1138,9 +10044,12 @@ int fcache_test_cache_clear_value_by_index(
 
 	/* Test error cases
 	 */
-	result = libfcache_cache_clear_value_by_index(
+	result = libfcache_cache_set_value_time_to_live_by_identifier(
 	          NULL,
 	          0,
+	          1024,
+	          0,
+	          0,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1155,8 +10064,11 @@ int fcache_test_cache_clear_value_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcache_cache_clear_value_by_index(
+	result = libfcache_cache_set_value_time_to_live_by_identifier(
 	          cache,
+	          0,
+	          1024,
+	          0,
 	          -1,
 	          &error );
 
@@ -1208,24 +10120,245 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcache_cache_get_value_by_identifier function
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* Tests the libfcache_cache_acquire_value_by_identifier function
  * Returns 1 if successful or 0 if not
  */
-int fcache_test_cache_get_value_by_identifier(
+int fcache_test_cache_acquire_value_by_identifier(
      void )
 {
+	uint8_t cache_flags[ 8 ] = {
+		0,
+		LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT,
+		LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT,
+		LIBFCACHE_CACHE_FLAG_FREQUENCY_ADMISSION,
+		LIBFCACHE_CACHE_FLAG_S3_FIFO_REPLACEMENT,
+		LIBFCACHE_CACHE_FLAG_GREEDY_DUAL_SIZE_REPLACEMENT,
+		LIBFCACHE_CACHE_FLAG_PREALLOCATE_VALUES,
+		LIBFCACHE_CACHE_FLAG_PREALLOCATE_VALUES | LIBFCACHE_CACHE_FLAG_TWO_QUEUE_REPLACEMENT };
+
 	uint8_t value_data[ 16 ];
 
-	libcerror_error_t *error             = NULL;
-	libfcache_cache_t *cache             = NULL;
-	libfcache_cache_value_t *cache_value = 0;
-	int result                           = 0;
+	libcerror_error_t *error                    = NULL;
+	libfcache_cache_t *cache                    = NULL;
+	libfcache_cache_value_t *cache_value        = NULL;
+	libfcache_cache_value_t *pinned_cache_value = NULL;
+	int cache_entry_index                       = 0;
+	int flags_index                             = 0;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	for( flags_index = 0;
+	     flags_index < 8;
+	     flags_index++ )
+	{
+		result = libfcache_cache_initialize_with_flags(
+		          &cache,
+		          4,
+		          cache_flags[ flags_index ],
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( cache_entry_index = 0;
+		     cache_entry_index < 4;
+		     cache_entry_index++ )
+		{
+			result = libfcache_cache_set_value_by_identifier_with_size(
+			          cache,
+			          0,
+			          (off64_t) cache_entry_index * 512,
+			          0,
+			          (intptr_t *) value_data,
+			          16,
+			          &fcache_test_cache_value_free_function,
+			          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+			          &error );
 
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfcache_cache_acquire_value_by_identifier(
+		          cache,
+		          0,
+		          0,
+		          0,
+		          &pinned_cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "pinned_cache_value",
+		 pinned_cache_value );
+
+		/* A pinned value is not replaced by other values
+		 */
+		for( cache_entry_index = 4;
+		     cache_entry_index < 16;
+		     cache_entry_index++ )
+		{
+			result = libfcache_cache_set_value_by_identifier_with_size(
+			          cache,
+			          0,
+			          (off64_t) cache_entry_index * 512,
+			          0,
+			          (intptr_t *) value_data,
+			          16,
+			          &fcache_test_cache_value_free_function,
+			          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+			          &error );
+
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          0,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+		 "cache_value",
+		 (intptr_t) cache_value,
+		 (intptr_t) pinned_cache_value );
+
+		/* A pinned value cannot be replaced or cleared by index
+		 */
+		result = libfcache_cache_set_value_by_index_with_size(
+		          cache,
+		          0,
+		          0,
+		          0,
+		          0,
+		          (intptr_t *) value_data,
+		          16,
+		          &fcache_test_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfcache_cache_clear_value_by_index(
+		          cache,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfcache_cache_release_value(
+		          cache,
+		          pinned_cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_clear_value_by_index(
+		          cache,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_free(
+		          &cache,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "cache",
+		 cache );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Initialize test
 	 */
 	result = libfcache_cache_initialize(
 	          &cache,
-	          16,
+	          2,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1241,12 +10374,13 @@ int fcache_test_cache_get_value_by_identifier(
 	 "error",
 	 error );
 
-	result = libfcache_cache_set_value_by_identifier(
+	result = libfcache_cache_set_value_by_identifier_with_size(
 	          cache,
 	          0,
 	          0,
 	          0,
 	          (intptr_t *) value_data,
+	          16,
 	          &fcache_test_cache_value_free_function,
 	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
@@ -1260,38 +10394,52 @@ int fcache_test_cache_get_value_by_identifier(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	result = libfcache_cache_set_value_by_identifier_with_size(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          16,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value that is not cached cannot be acquired
 	 */
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfcache_cache_acquire_value_by_identifier(
 	          cache,
 	          0,
-	          0,
+	          1024,
 	          0,
 	          &cache_value,
 	          &error );
 
-	FCACHE_TEST_ASSERT_NOT_EQUAL_INT(
+	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "cache_value",
-	 cache_value );
+	 0 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	FCACHE_TEST_ASSERT_IS_NULL(
 	 "cache_value",
 	 cache_value );
 
 	/* Test error cases
 	 */
-	cache_value = NULL;
-
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfcache_cache_acquire_value_by_identifier(
 	          NULL,
 	          0,
 	          0,
@@ -1304,10 +10452,6 @@ int fcache_test_cache_get_value_by_identifier(
 	 result,
 	 -1 );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
-
 	FCACHE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1315,22 +10459,57 @@ int fcache_test_cache_get_value_by_identifier(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfcache_cache_acquire_value_by_identifier(
 	          cache,
 	          0,
 	          0,
 	          0,
-	          NULL,
+	          &pinned_cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
+	 "error",
+	 error );
+
+	result = libfcache_cache_acquire_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value cannot be set if all values are pinned
+	 */
+	result = libfcache_cache_set_value_by_identifier_with_size(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          (intptr_t *) value_data,
+	          16,
+	          &fcache_test_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FCACHE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1375,24 +10554,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcache_cache_get_value_by_index function
+/* Tests the libfcache_cache_release_value function
  * Returns 1 if successful or 0 if not
  */
-int fcache_test_cache_get_value_by_index(
+int fcache_test_cache_release_value(
      void )
 {
 	uint8_t value_data[ 16 ];
 
 	libcerror_error_t *error             = NULL;
 	libfcache_cache_t *cache             = NULL;
-	libfcache_cache_value_t *cache_value = 0;
+	libfcache_cache_value_t *cache_value = NULL;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
 	result = libfcache_cache_initialize(
 	          &cache,
-	          16,
+	          2,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1408,13 +10587,13 @@ int fcache_test_cache_get_value_by_index(
 	 "error",
 	 error );
 
-	result = libfcache_cache_set_value_by_index(
+	result = libfcache_cache_set_value_by_identifier_with_size(
 	          cache,
 	          0,
 	          0,
 	          0,
-	          0,
 	          (intptr_t *) value_data,
+	          16,
 	          &fcache_test_cache_value_free_function,
 	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
 	          &error );
@@ -1428,39 +10607,44 @@ int fcache_test_cache_get_value_by_index(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfcache_cache_get_value_by_index(
+	result = libfcache_cache_acquire_value_by_identifier(
 	          cache,
 	          0,
+	          0,
+	          0,
 	          &cache_value,
 	          &error );
 
-	FCACHE_TEST_ASSERT_NOT_EQUAL_INT(
+	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "cache_value",
-	 cache_value );
+	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "cache_value",
-	 cache_value );
+	/* Test regular cases
+	 */
+	result = libfcache_cache_release_value(
+	          cache,
+	          cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	cache_value = NULL;
-
-	result = libfcache_cache_get_value_by_index(
+	result = libfcache_cache_release_value(
 	          NULL,
-	          0,
-	          &cache_value,
+	          cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1468,10 +10652,6 @@ int fcache_test_cache_get_value_by_index(
 	 result,
 	 -1 );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
-
 	FCACHE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1479,10 +10659,9 @@ int fcache_test_cache_get_value_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcache_cache_get_value_by_index(
+	result = libfcache_cache_release_value(
 	          cache,
-	          -1,
-	          &cache_value,
+	          NULL,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1490,10 +10669,6 @@ int fcache_test_cache_get_value_by_index(
 	 result,
 	 -1 );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
-
 	FCACHE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1501,10 +10676,11 @@ int fcache_test_cache_get_value_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcache_cache_get_value_by_index(
+	/* A value that is not acquired cannot be released
+	 */
+	result = libfcache_cache_release_value(
 	          cache,
-	          0,
-	          NULL,
+	          cache_value,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
@@ -1512,10 +10688,6 @@ int fcache_test_cache_get_value_by_index(
 	 result,
 	 -1 );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
-
 	FCACHE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1559,18 +10731,103 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcache_cache_set_value_by_identifier function
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+/* The number of threads and iterations of the multi-threading test
+ */
+#define FCACHE_TEST_CACHE_NUMBER_OF_THREADS	4
+#define FCACHE_TEST_CACHE_NUMBER_OF_ITERATIONS	4096
+
+/* The value data of the multi-threading test
+ */
+uint8_t fcache_test_cache_thread_value_data[ 16 ];
+
+/* Sets and retrieves cache values from a thread
+ * Returns NULL if successful or a non-NULL value if not
+ */
+void *fcache_test_cache_thread_function(
+       void *arguments )
+{
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	int iteration                        = 0;
+	int number_of_cache_values           = 0;
+	int result                           = 0;
+
+	cache = (libfcache_cache_t *) arguments;
+
+	for( iteration = 0;
+	     iteration < FCACHE_TEST_CACHE_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          (off64_t) ( iteration % 64 ),
+		          0,
+		          &cache_value,
+		          NULL );
+
+		if( result == -1 )
+		{
+			return( arguments );
+		}
+		else if( result == 0 )
+		{
+			result = libfcache_cache_set_value_by_identifier(
+			          cache,
+			          0,
+			          (off64_t) ( iteration % 64 ),
+			          0,
+			          (intptr_t *) fcache_test_cache_thread_value_data,
+			          &fcache_test_cache_value_free_function,
+			          LIBFCACHE_CACHE_VALUE_FLAG_NON_MANAGED,
+			          NULL );
+
+			if( result != 1 )
+			{
+				return( arguments );
+			}
+		}
+		result = libfcache_cache_get_value_by_index(
+		          cache,
+		          iteration % 16,
+		          &cache_value,
+		          NULL );
+
+		if( result != 1 )
+		{
+			return( arguments );
+		}
+		result = libfcache_cache_get_number_of_cache_values(
+		          cache,
+		          &number_of_cache_values,
+		          NULL );
+
+		if( ( result != 1 )
+		 || ( number_of_cache_values > 16 ) )
+		{
+			return( arguments );
+		}
+	}
+	return( NULL );
+}
+
+/* Tests the cache functions from multiple threads
  * Returns 1 if successful or 0 if not
  */
-int fcache_test_cache_set_value_by_identifier(
+int fcache_test_cache_multi_thread(
      void )
 {
-	uint8_t value_data[ 16 ];
+	pthread_t threads[ FCACHE_TEST_CACHE_NUMBER_OF_THREADS ];
 
-	libcerror_error_t *error             = NULL;
-	libfcache_cache_t *cache             = NULL;
-	libfcache_cache_value_t *cache_value = 0;
-	int result                           = 0;
+	libcerror_error_t *error   = NULL;
+	libfcache_cache_t *cache   = NULL;
+	void *thread_result        = NULL;
+	int number_of_cache_values = 0;
+	int number_of_threads      = 0;
+	int result                 = 0;
+	int thread_index           = 0;
 
 	/* Initialize test
 	 */
@@ -1594,114 +10851,58 @@ int fcache_test_cache_set_value_by_identifier(
 
 	/* Test regular cases
 	 */
-	result = libfcache_cache_set_value_by_identifier(
-	          cache,
-	          0,
-	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          &fcache_test_cache_value_free_function,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	          &error );
-
-	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libfcache_cache_set_value_by_identifier(
-	          NULL,
-	          0,
-	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          &fcache_test_cache_value_free_function,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	          &error );
-
-	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
-
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfcache_cache_set_value_by_identifier(
-	          cache,
-	          0,
-	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          NULL,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	          &error );
-
-	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
-
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_FCACHE_TEST_MEMORY )
-
-	/* Test libfcache_cache_value_clear with malloc failing
-	 */
-	fcache_test_malloc_attempts_before_fail = 0;
+	for( thread_index = 0;
+	     thread_index < FCACHE_TEST_CACHE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &fcache_test_cache_thread_function,
+		          (void *) cache );
 
-	result = libfcache_cache_set_value_by_identifier(
-	          cache,
-	          0,
-	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          &fcache_test_cache_value_free_function,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	          &error );
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	if( fcache_test_malloc_attempts_before_fail != -1 )
-	{
-		fcache_test_malloc_attempts_before_fail = -1;
+		number_of_threads++;
 	}
-	else
+	while( number_of_threads > 0 )
 	{
+		number_of_threads--;
+
+		result = pthread_join(
+		          threads[ number_of_threads ],
+		          &thread_result );
+
 		FCACHE_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
-
-		FCACHE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+		 0 );
 
-		libcerror_error_free(
-		 &error );
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "thread_result",
+		 thread_result );
 	}
-#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+	result = libfcache_cache_get_number_of_cache_values(
+	          cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 16 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Clean up
 	 */
@@ -1725,6 +10926,14 @@ int fcache_test_cache_set_value_by_identifier(
 	return( 1 );
 
 on_error:
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -1739,153 +10948,175 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcache_cache_set_value_by_index function
- * Returns 1 if successful or 0 if not
+/* The number of times the multi-threading load value function was called
  */
-int fcache_test_cache_set_value_by_index(
-     void )
-{
-	uint8_t value_data[ 16 ];
+int fcache_test_cache_thread_number_of_loads = 0;
 
-	libcerror_error_t *error             = NULL;
-	libfcache_cache_t *cache             = NULL;
-	libfcache_cache_value_t *cache_value = 0;
-	int result                           = 0;
+/* The mutex that protects the number of loads of the multi-threading test
+ */
+pthread_mutex_t fcache_test_cache_thread_loads_mutex = PTHREAD_MUTEX_INITIALIZER;
 
-	/* Initialize test
-	 */
-	result = libfcache_cache_initialize(
-	          &cache,
-	          16,
-	          &error );
+/* Test load value function of the multi-threading test
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_cache_thread_load_value(
+     intptr_t *load_data,
+     int file_index FCACHE_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int64_t timestamp FCACHE_TEST_ATTRIBUTE_UNUSED,
+     intptr_t **value,
+     size_t *value_size,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	volatile int iteration = 0;
 
-	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	FCACHE_TEST_UNREFERENCED_PARAMETER( file_index )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( offset )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( timestamp )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "cache",
-	 cache );
+	pthread_mutex_lock(
+	 &fcache_test_cache_thread_loads_mutex );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	fcache_test_cache_thread_number_of_loads++;
 
-	/* Test regular cases
+	pthread_mutex_unlock(
+	 &fcache_test_cache_thread_loads_mutex );
+
+	/* Simulate a slow read so that the other threads miss while the value is loaded
 	 */
-	result = libfcache_cache_set_value_by_index(
-	          cache,
-	          0,
-	          0,
-	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          &fcache_test_cache_value_free_function,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	          &error );
+	for( iteration = 0;
+	     iteration < 1000000;
+	     iteration++ )
+	{
+	}
+	*value      = load_data;
+	*value_size = 16;
 
-	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	return( 1 );
+}
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+/* Retrieves or loads the same cache value from a thread
+ * Returns NULL if successful or a non-NULL value if not
+ */
+void *fcache_test_cache_get_or_load_thread_function(
+       void *arguments )
+{
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	intptr_t *value                      = NULL;
+	int result                           = 0;
 
-	/* Test error cases
-	 */
-	result = libfcache_cache_set_value_by_index(
-	          NULL,
-	          0,
-	          0,
+	cache = (libfcache_cache_t *) arguments;
+
+	result = libfcache_cache_get_or_load_value(
+	          cache,
 	          0,
+	          4096,
 	          0,
-	          (intptr_t *) value_data,
+	          &fcache_test_cache_thread_load_value,
+	          (intptr_t *) fcache_test_cache_thread_value_data,
 	          &fcache_test_cache_value_free_function,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	          &error );
+	          LIBFCACHE_CACHE_VALUE_FLAG_NON_MANAGED,
+	          &cache_value,
+	          NULL );
 
-	FCACHE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	if( result != 1 )
+	{
+		return( arguments );
+	}
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          &value,
+	          NULL );
 
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
+	if( ( result != 1 )
+	 || ( value != (intptr_t *) fcache_test_cache_thread_value_data ) )
+	{
+		return( arguments );
+	}
+	return( NULL );
+}
 
-	FCACHE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+/* Tests the libfcache_cache_get_or_load_value function from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_cache_get_or_load_value_multi_thread(
+     void )
+{
+	pthread_t threads[ FCACHE_TEST_CACHE_NUMBER_OF_THREADS ];
 
-	libcerror_error_free(
-	 &error );
+	libcerror_error_t *error = NULL;
+	libfcache_cache_t *cache = NULL;
+	void *thread_result      = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+	int thread_index         = 0;
 
-	result = libfcache_cache_set_value_by_index(
-	          cache,
-	          0,
-	          0,
-	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          NULL,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          16,
 	          &error );
 
 	FCACHE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FCACHE_TEST_ASSERT_IS_NULL(
-	 "cache_value",
-	 cache_value );
+	 1 );
 
 	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_FCACHE_TEST_MEMORY )
+	fcache_test_cache_thread_number_of_loads = 0;
 
-	/* Test libfcache_cache_value_clear with malloc failing
+	/* Test regular cases
 	 */
-	fcache_test_malloc_attempts_before_fail = 0;
+	for( thread_index = 0;
+	     thread_index < FCACHE_TEST_CACHE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &fcache_test_cache_get_or_load_thread_function,
+		          (void *) cache );
 
-	result = libfcache_cache_set_value_by_index(
-	          cache,
-	          1,
-	          0,
-	          0,
-	          0,
-	          (intptr_t *) value_data,
-	          &fcache_test_cache_value_free_function,
-	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	          &error );
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	if( fcache_test_malloc_attempts_before_fail != -1 )
-	{
-		fcache_test_malloc_attempts_before_fail = -1;
+		number_of_threads++;
 	}
-	else
+	while( number_of_threads > 0 )
 	{
+		number_of_threads--;
+
+		result = pthread_join(
+		          threads[ number_of_threads ],
+		          &thread_result );
+
 		FCACHE_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
-
-		FCACHE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+		 0 );
 
-		libcerror_error_free(
-		 &error );
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "thread_result",
+		 thread_result );
 	}
-#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+	/* The value is loaded only once
+	 */
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "fcache_test_cache_thread_number_of_loads",
+	 fcache_test_cache_thread_number_of_loads,
+	 1 );
 
 	/* Clean up
 	 */
@@ -1909,6 +11140,14 @@ int fcache_test_cache_set_value_by_index(
 	return( 1 );
 
 on_error:
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -1923,6 +11162,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1942,6 +11183,14 @@ int main(
 	 "libfcache_cache_initialize",
 	 fcache_test_cache_initialize );
 
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_initialize_with_flags",
+	 fcache_test_cache_initialize_with_flags );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_initialize_with_policy",
+	 fcache_test_cache_initialize_with_policy );
+
 	FCACHE_TEST_RUN(
 	 "libfcache_cache_free",
 	 fcache_test_cache_free );
@@ -1966,14 +11215,77 @@ int main(
 	 "libfcache_cache_get_number_of_cache_values",
 	 fcache_test_cache_get_number_of_cache_values );
 
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_get_maximum_cache_size",
+	 fcache_test_cache_get_maximum_cache_size );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_maximum_cache_size",
+	 fcache_test_cache_set_maximum_cache_size );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_get_cache_size",
+	 fcache_test_cache_get_cache_size );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_get_time_to_live",
+	 fcache_test_cache_get_time_to_live );
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_time_to_live",
+	 fcache_test_cache_set_time_to_live );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
 	FCACHE_TEST_RUN(
 	 "libfcache_cache_clear_value_by_index",
 	 fcache_test_cache_clear_value_by_index );
 
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_invalidate_file",
+	 fcache_test_cache_invalidate_file );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_invalidate_range",
+	 fcache_test_cache_invalidate_range );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_iterate_values_in_range",
+	 fcache_test_cache_iterate_values_in_range );
+
 	FCACHE_TEST_RUN(
 	 "libfcache_cache_get_value_by_identifier",
 	 fcache_test_cache_get_value_by_identifier );
 
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_get_values_by_identifiers",
+	 fcache_test_cache_get_values_by_identifiers );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_get_or_load_value",
+	 fcache_test_cache_get_or_load_value );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_get_or_load_value_set_failure",
+	 fcache_test_cache_get_or_load_value_set_failure );
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+#if defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_internal_cache_get_value_by_identifier_for_read",
+	 fcache_test_internal_cache_get_value_by_identifier_for_read );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_internal_cache_apply_hit_buffers",
+	 fcache_test_internal_cache_apply_hit_buffers );
+
+#endif /* defined( HAVE_LIBFCACHE_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
 	FCACHE_TEST_RUN(
 	 "libfcache_cache_get_value_by_index",
 	 fcache_test_cache_get_value_by_index );
@@ -1982,10 +11294,70 @@ int main(
 	 "libfcache_cache_set_value_by_identifier",
 	 fcache_test_cache_set_value_by_identifier );
 
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_value_by_identifier_replace",
+	 fcache_test_cache_set_value_by_identifier_replace );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_value_by_identifier_unused",
+	 fcache_test_cache_set_value_by_identifier_unused );
+
 	FCACHE_TEST_RUN(
 	 "libfcache_cache_set_value_by_index",
 	 fcache_test_cache_set_value_by_index );
 
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_value_by_identifier_with_size",
+	 fcache_test_cache_set_value_by_identifier_with_size );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_value_by_index_with_size",
+	 fcache_test_cache_set_value_by_index_with_size );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_value_by_identifier_with_cost",
+	 fcache_test_cache_set_value_by_identifier_with_cost );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_value_by_index_with_cost",
+	 fcache_test_cache_set_value_by_index_with_cost );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_values_by_identifiers",
+	 fcache_test_cache_set_values_by_identifiers );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_exchange_value_by_identifier",
+	 fcache_test_cache_exchange_value_by_identifier );
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_set_value_time_to_live_by_identifier",
+	 fcache_test_cache_set_value_time_to_live_by_identifier );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_acquire_value_by_identifier",
+	 fcache_test_cache_acquire_value_by_identifier );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_release_value",
+	 fcache_test_cache_release_value );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache multi-threading",
+	 fcache_test_cache_multi_thread );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_cache_get_or_load_value multi-threading",
+	 fcache_test_cache_get_or_load_value_multi_thread );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,1036 @@
+/*
+ * Library clock type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_clock.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_clock_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_clock_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfcache_clock_t *cache_clock = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_clock_initialize(
+	          &cache_clock,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_free(
+	          &cache_clock,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_clock_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache_clock = (libfcache_clock_t *) 0x12345678UL;
+
+	result = libfcache_clock_initialize(
+	          &cache_clock,
+	          8,
+	          &error );
+
+	cache_clock = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_clock_initialize(
+	          &cache_clock,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_clock != NULL )
+	{
+		libfcache_clock_free(
+		 &cache_clock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_clock_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_clock_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_clock_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_clock_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_clock_clear(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfcache_clock_t *cache_clock = NULL;
+	int result                     = 0;
+	int slot                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_clock_initialize(
+	          &cache_clock,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_reference_slot(
+	          cache_clock,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_clock_clear(
+	          cache_clock,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The reference bit of slot 0 was cleared so it is the first victim
+	 */
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_clock_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_clock_free(
+	          &cache_clock,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_clock != NULL )
+	{
+		libfcache_clock_free(
+		 &cache_clock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_clock_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_clock_resize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfcache_clock_t *cache_clock = NULL;
+	int result                     = 0;
+	int slot                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_clock_initialize(
+	          &cache_clock,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_clock_resize(
+	          cache_clock,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_reference_slot(
+	          cache_clock,
+	          7,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Move the hand beyond the slots that remain after shrinking
+	 */
+	for( slot = 0;
+	     slot < 6;
+	     slot++ )
+	{
+		result = libfcache_clock_reference_slot(
+		          cache_clock,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 6 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_resize(
+	          cache_clock,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_clock_resize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_clock_resize(
+	          cache_clock,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_clock_free(
+	          &cache_clock,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_clock != NULL )
+	{
+		libfcache_clock_free(
+		 &cache_clock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_clock_insert_slot, libfcache_clock_reference_slot
+ * and libfcache_clock_remove_slot functions
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_clock_reference_slot(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfcache_clock_t *cache_clock = NULL;
+	int result                     = 0;
+	int slot                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_clock_initialize(
+	          &cache_clock,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_clock_reference_slot(
+	          cache_clock,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "cache_clock->reference_bits[ 2 ]",
+	 cache_clock->reference_bits[ 2 ],
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_insert_slot(
+	          cache_clock,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "cache_clock->reference_bits[ 2 ]",
+	 cache_clock->reference_bits[ 2 ],
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_reference_slot(
+	          cache_clock,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_clock_remove_slot(
+	          cache_clock,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "cache_clock->reference_bits[ 3 ]",
+	 cache_clock->reference_bits[ 3 ],
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	for( slot = -1;
+	     slot <= 4;
+	     slot += 5 )
+	{
+		result = libfcache_clock_insert_slot(
+		          cache_clock,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfcache_clock_reference_slot(
+		          cache_clock,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfcache_clock_remove_slot(
+		          cache_clock,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libfcache_clock_reference_slot(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_clock_free(
+	          &cache_clock,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_clock != NULL )
+	{
+		libfcache_clock_free(
+		 &cache_clock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_clock_get_victim_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_clock_get_victim_slot(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfcache_clock_t *cache_clock = NULL;
+	int result                     = 0;
+	int slot                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_clock_initialize(
+	          &cache_clock,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( slot = 0;
+	     slot < 2;
+	     slot++ )
+	{
+		result = libfcache_clock_reference_slot(
+		          cache_clock,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The referenced slots 0 and 1 get a second chance
+	 */
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "cache_clock->reference_bits[ 0 ]",
+	 cache_clock->reference_bits[ 0 ],
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "cache_clock->reference_bits[ 1 ]",
+	 cache_clock->reference_bits[ 1 ],
+	 0 );
+
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 3 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The hand wraps around to slot 0 which lost its reference bit in the first sweep
+	 */
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* When all slots are referenced the sweep returns to where it started
+	 */
+	for( slot = 0;
+	     slot < 4;
+	     slot++ )
+	{
+		result = libfcache_clock_reference_slot(
+		          cache_clock,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_clock_get_victim_slot(
+	          NULL,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_clock_get_victim_slot(
+	          cache_clock,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_clock_free(
+	          &cache_clock,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_clock",
+	 cache_clock );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_clock != NULL )
+	{
+		libfcache_clock_free(
+		 &cache_clock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_clock_initialize",
+	 fcache_test_clock_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_clock_free",
+	 fcache_test_clock_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_clock_clear",
+	 fcache_test_clock_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_clock_resize",
+	 fcache_test_clock_resize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_clock_reference_slot",
+	 fcache_test_clock_reference_slot );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_clock_get_victim_slot",
+	 fcache_test_clock_get_victim_slot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
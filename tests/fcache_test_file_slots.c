@@ -0,0 +1,2020 @@
+/*
+ * Library file_slots type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_definitions.h"
+#include "../libfcache/libfcache_file_slots.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_file_slots_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_slots",
+	 file_slots );
+
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_slots = (libfcache_file_slots_t *) 0x12345678UL;
+
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_slots = NULL;
+
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_clear(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int number_of_slots                = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          1,
+	          7,
+	          1536,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_clear(
+	          file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          7,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_resize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int number_of_slots                = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          1,
+	          7,
+	          1536,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          3,
+	          7,
+	          512,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_resize(
+	          file_slots,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          7,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 1 );
+
+	result = libfcache_file_slots_resize(
+	          file_slots,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          6,
+	          7,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          7,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_resize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_resize(
+	          file_slots,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_get_number_of_slots function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_get_number_of_slots(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int number_of_slots                = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          0,
+	          2,
+	          2048,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          2,
+	          2,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          2,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 2 );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          5,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_get_number_of_slots(
+	          NULL,
+	          2,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          2,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_get_first_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_get_first_slot(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int slot                           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          0,
+	          2,
+	          2048,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          2,
+	          2,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_get_first_slot(
+	          file_slots,
+	          2,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 2 );
+
+	result = libfcache_file_slots_get_first_slot(
+	          file_slots,
+	          5,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_get_first_slot(
+	          NULL,
+	          2,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_get_first_slot(
+	          file_slots,
+	          2,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_get_first_slot_from_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_get_first_slot_from_offset(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	off64_t offset                     = 0;
+	int number_of_slots                = 0;
+	int result                         = 0;
+	int slot                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          64,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Insert the slots in an order that differs from the order of their offsets
+	 */
+	for( slot = 0;
+	     slot < 64;
+	     slot++ )
+	{
+		result = libfcache_file_slots_insert_slot(
+		          file_slots,
+		          slot,
+		          1,
+		          (off64_t) ( ( slot * 37 ) % 64 ) * 512,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Remove every third slot
+	 */
+	for( slot = 0;
+	     slot < 64;
+	     slot += 3 )
+	{
+		result = libfcache_file_slots_remove_slot(
+		          file_slots,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_get_first_slot_from_offset(
+	          file_slots,
+	          1,
+	          1000,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) file_slots->entries[ slot ].offset,
+	 (int64_t) 1024 );
+
+	/* Test that the next slots are ordered by offset
+	 */
+	offset          = file_slots->entries[ slot ].offset;
+	number_of_slots = 1;
+
+	do
+	{
+		result = libfcache_file_slots_get_next_slot(
+		          file_slots,
+		          slot,
+		          &slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			FCACHE_TEST_ASSERT_GREATER_THAN_INT(
+			 "offset",
+			 (int) file_slots->entries[ slot ].offset,
+			 (int) offset );
+
+			offset           = file_slots->entries[ slot ].offset;
+			number_of_slots += 1;
+		}
+	}
+	while( result == 1 );
+
+	/* 42 slots remain, the slots with offset 0 and 512 were removed
+	 */
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 42 );
+
+	result = libfcache_file_slots_get_first_slot_from_offset(
+	          file_slots,
+	          1,
+	          64 * 512,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_first_slot_from_offset(
+	          file_slots,
+	          2,
+	          0,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_get_first_slot_from_offset(
+	          NULL,
+	          1,
+	          0,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_get_first_slot_from_offset(
+	          file_slots,
+	          1,
+	          0,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_get_next_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_get_next_slot(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int slot                           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          0,
+	          2,
+	          2048,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          2,
+	          2,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_get_next_slot(
+	          file_slots,
+	          2,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	result = libfcache_file_slots_get_next_slot(
+	          file_slots,
+	          0,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_get_next_slot(
+	          NULL,
+	          0,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_get_next_slot(
+	          file_slots,
+	          -1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_get_next_slot(
+	          file_slots,
+	          4,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_get_next_slot(
+	          file_slots,
+	          0,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_insert_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_insert_slot(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int number_of_slots                = 0;
+	int slot                           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          0,
+	          5,
+	          2048,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          1,
+	          3,
+	          1536,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          2,
+	          5,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          5,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 2 );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          3,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 1 );
+
+	/* Test inserting a slot that is already stored for another file index
+	 */
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          2,
+	          3,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          5,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 1 );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          3,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 2 );
+
+	result = libfcache_file_slots_get_first_slot(
+	          file_slots,
+	          3,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 2 );
+
+	result = libfcache_file_slots_get_next_slot(
+	          file_slots,
+	          2,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_insert_slot(
+	          NULL,
+	          0,
+	          5,
+	          2048,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          -1,
+	          5,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          4,
+	          5,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_file_slots_remove_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_file_slots_remove_slot(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfcache_file_slots_t *file_slots = NULL;
+	int number_of_slots                = 0;
+	int slot                           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_file_slots_initialize(
+	          &file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          0,
+	          5,
+	          2048,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          1,
+	          5,
+	          1536,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_insert_slot(
+	          file_slots,
+	          2,
+	          5,
+	          1024,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_file_slots_remove_slot(
+	          file_slots,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_number_of_slots(
+	          file_slots,
+	          5,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 2 );
+
+	result = libfcache_file_slots_get_first_slot(
+	          file_slots,
+	          5,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 2 );
+
+	result = libfcache_file_slots_get_next_slot(
+	          file_slots,
+	          2,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	/* Test removing a slot that is not stored
+	 */
+	result = libfcache_file_slots_remove_slot(
+	          file_slots,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_remove_slot(
+	          file_slots,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_remove_slot(
+	          file_slots,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_file_slots_get_first_slot(
+	          file_slots,
+	          5,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_file_slots_remove_slot(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_remove_slot(
+	          file_slots,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_file_slots_remove_slot(
+	          file_slots,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_file_slots_free(
+	          &file_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "file_slots",
+	 file_slots );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_slots != NULL )
+	{
+		libfcache_file_slots_free(
+		 &file_slots,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_initialize",
+	 fcache_test_file_slots_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_free",
+	 fcache_test_file_slots_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_clear",
+	 fcache_test_file_slots_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_resize",
+	 fcache_test_file_slots_resize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_get_number_of_slots",
+	 fcache_test_file_slots_get_number_of_slots );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_get_first_slot",
+	 fcache_test_file_slots_get_first_slot );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_get_first_slot_from_offset",
+	 fcache_test_file_slots_get_first_slot_from_offset );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_get_next_slot",
+	 fcache_test_file_slots_get_next_slot );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_insert_slot",
+	 fcache_test_file_slots_insert_slot );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_file_slots_remove_slot",
+	 fcache_test_file_slots_remove_slot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,856 @@
+/*
+ * Library frequency_sketch type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_definitions.h"
+#include "../libfcache/libfcache_frequency_sketch.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_frequency_sketch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_frequency_sketch_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfcache_frequency_sketch_t *frequency_sketch = NULL;
+	int result                                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_frequency_sketch_initialize(
+	          &frequency_sketch,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_frequency_sketch_free(
+	          &frequency_sketch,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_frequency_sketch_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	frequency_sketch = (libfcache_frequency_sketch_t *) 0x12345678UL;
+
+	result = libfcache_frequency_sketch_initialize(
+	          &frequency_sketch,
+	          8,
+	          &error );
+
+	frequency_sketch = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_frequency_sketch_initialize(
+	          &frequency_sketch,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( frequency_sketch != NULL )
+	{
+		libfcache_frequency_sketch_free(
+		 &frequency_sketch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_frequency_sketch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_frequency_sketch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_frequency_sketch_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_frequency_sketch_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_frequency_sketch_clear(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfcache_frequency_sketch_t *frequency_sketch = NULL;
+	int result                                     = 0;
+	uint8_t estimate                               = 0;
+	int iterator                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_frequency_sketch_initialize(
+	          &frequency_sketch,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( iterator = 0;
+	     iterator < 3;
+	     iterator++ )
+	{
+		result = libfcache_frequency_sketch_increment(
+		          frequency_sketch,
+		          0,
+		          512,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test regular cases
+	 */
+	result = libfcache_frequency_sketch_clear(
+	          frequency_sketch,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          512,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "estimate",
+	 estimate,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcache_frequency_sketch_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_frequency_sketch_free(
+	          &frequency_sketch,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( frequency_sketch != NULL )
+	{
+		libfcache_frequency_sketch_free(
+		 &frequency_sketch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_frequency_sketch_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_frequency_sketch_resize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfcache_frequency_sketch_t *frequency_sketch = NULL;
+	int result                                     = 0;
+	uint8_t estimate                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_frequency_sketch_initialize(
+	          &frequency_sketch,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_frequency_sketch_resize(
+	          frequency_sketch,
+	          1000,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "frequency_sketch->number_of_counters",
+	 frequency_sketch->number_of_counters,
+	 1024 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "frequency_sketch->counter_shift",
+	 frequency_sketch->counter_shift,
+	 22 );
+
+	result = libfcache_frequency_sketch_increment(
+	          frequency_sketch,
+	          0,
+	          512,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          512,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "estimate",
+	 estimate,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfcache_frequency_sketch_resize(
+	          NULL,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_frequency_sketch_resize(
+	          frequency_sketch,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_frequency_sketch_free(
+	          &frequency_sketch,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( frequency_sketch != NULL )
+	{
+		libfcache_frequency_sketch_free(
+		 &frequency_sketch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_frequency_sketch_increment function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_frequency_sketch_increment(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfcache_frequency_sketch_t *frequency_sketch = NULL;
+	int result                                     = 0;
+	uint8_t estimate                               = 0;
+	int iterator                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_frequency_sketch_initialize(
+	          &frequency_sketch,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "frequency_sketch->number_of_counters",
+	 frequency_sketch->number_of_counters,
+	 LIBFCACHE_FREQUENCY_SKETCH_MINIMUM_NUMBER_OF_COUNTERS );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < 3;
+	     iterator++ )
+	{
+		result = libfcache_frequency_sketch_increment(
+		          frequency_sketch,
+		          0,
+		          512,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          512,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "estimate",
+	 estimate,
+	 3 );
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          1024,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "estimate",
+	 estimate,
+	 0 );
+
+	/* Test that the counters saturate
+	 */
+	for( iterator = 0;
+	     iterator < 32;
+	     iterator++ )
+	{
+		result = libfcache_frequency_sketch_increment(
+		          frequency_sketch,
+		          0,
+		          1024,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          1024,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "estimate",
+	 estimate,
+	 LIBFCACHE_FREQUENCY_SKETCH_MAXIMUM_COUNTER_VALUE );
+
+	/* Test that the counters are halved when the sample size is reached
+	 */
+	frequency_sketch->number_of_increments = frequency_sketch->sample_size - 1;
+
+	result = libfcache_frequency_sketch_increment(
+	          frequency_sketch,
+	          0,
+	          512,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          512,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "estimate",
+	 estimate,
+	 2 );
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          1024,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "estimate",
+	 estimate,
+	 7 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "frequency_sketch->number_of_increments",
+	 frequency_sketch->number_of_increments,
+	 frequency_sketch->sample_size / 2 );
+
+	/* Test error cases
+	 */
+	result = libfcache_frequency_sketch_increment(
+	          NULL,
+	          0,
+	          512,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          NULL,
+	          0,
+	          512,
+	          &estimate,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_frequency_sketch_get_estimate(
+	          frequency_sketch,
+	          0,
+	          512,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_frequency_sketch_free(
+	          &frequency_sketch,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( frequency_sketch != NULL )
+	{
+		libfcache_frequency_sketch_free(
+		 &frequency_sketch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_frequency_sketch_initialize",
+	 fcache_test_frequency_sketch_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_frequency_sketch_free",
+	 fcache_test_frequency_sketch_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_frequency_sketch_clear",
+	 fcache_test_frequency_sketch_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_frequency_sketch_resize",
+	 fcache_test_frequency_sketch_resize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_frequency_sketch_increment",
+	 fcache_test_frequency_sketch_increment );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
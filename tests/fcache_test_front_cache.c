@@ -0,0 +1,934 @@
+/*
+ * Library front_cache type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_memory.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_front_cache.h"
+
+/* Test value free function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_front_cache_value_free_function(
+     intptr_t **value FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( value )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* Tests the libfcache_front_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_front_cache_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_front_cache_t *front_cache = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_front_cache_initialize(
+	          &front_cache,
+	          cache,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "front_cache",
+	 front_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_front_cache_free(
+	          &front_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "front_cache",
+	 front_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_front_cache_initialize(
+	          NULL,
+	          cache,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	front_cache = (libfcache_front_cache_t *) 0x12345678UL;
+
+	result = libfcache_front_cache_initialize(
+	          &front_cache,
+	          cache,
+	          4,
+	          &error );
+
+	front_cache = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_front_cache_initialize(
+	          &front_cache,
+	          NULL,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_front_cache_initialize(
+	          &front_cache,
+	          cache,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_front_cache_initialize(
+	          &front_cache,
+	          cache,
+	          LIBFCACHE_FRONT_CACHE_MAXIMUM_NUMBER_OF_ENTRIES + 1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+
+	/* 1 fail in memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcache_front_cache_initialize with malloc failing
+		 */
+		fcache_test_malloc_attempts_before_fail = test_number;
+
+		result = libfcache_front_cache_initialize(
+		          &front_cache,
+		          cache,
+		          4,
+		          &error );
+
+		if( fcache_test_malloc_attempts_before_fail != -1 )
+		{
+			fcache_test_malloc_attempts_before_fail = -1;
+
+			if( front_cache != NULL )
+			{
+				libfcache_front_cache_free(
+				 &front_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "front_cache",
+			 front_cache );
+
+			FCACHE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* 1 fail in memset after memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcache_front_cache_initialize with memset failing
+		 */
+		fcache_test_memset_attempts_before_fail = test_number;
+
+		result = libfcache_front_cache_initialize(
+		          &front_cache,
+		          cache,
+		          4,
+		          &error );
+
+		if( fcache_test_memset_attempts_before_fail != -1 )
+		{
+			fcache_test_memset_attempts_before_fail = -1;
+
+			if( front_cache != NULL )
+			{
+				libfcache_front_cache_free(
+				 &front_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "front_cache",
+			 front_cache );
+
+			FCACHE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( front_cache != NULL )
+	{
+		libfcache_front_cache_free(
+		 &front_cache,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_front_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_front_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_front_cache_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_front_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_front_cache_empty(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_front_cache_t *front_cache = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_front_cache_initialize(
+	          &front_cache,
+	          cache,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "front_cache",
+	 front_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_front_cache_empty(
+	          front_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_front_cache_empty(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_front_cache_free(
+	          &front_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "front_cache",
+	 front_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( front_cache != NULL )
+	{
+		libfcache_front_cache_free(
+		 &front_cache,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_front_cache_get_value_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_front_cache_get_value_by_identifier(
+     void )
+{
+	uint8_t value_data1[ 16 ];
+	uint8_t value_data2[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *cache             = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	libfcache_front_cache_t *front_cache = NULL;
+	intptr_t *value                      = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &cache,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_front_cache_initialize(
+	          &front_cache,
+	          cache,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "front_cache",
+	 front_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data1,
+	          &fcache_test_front_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* The first retrieval fills the front cache and the second is a front cache hit
+	 */
+	result = libfcache_front_cache_get_value_by_identifier(
+	          front_cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_front_cache_get_value_by_identifier(
+	          front_cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          &value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 value,
+	 (intptr_t *) value_data1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value that is evicted from the cache is not retrieved from the front cache
+	 */
+	result = libfcache_cache_set_value_by_identifier(
+	          cache,
+	          0,
+	          1024,
+	          0,
+	          (intptr_t *) value_data2,
+	          &fcache_test_front_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_front_cache_get_value_by_identifier(
+	          front_cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_front_cache_get_value_by_identifier(
+	          front_cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          &value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 value,
+	 (intptr_t *) value_data2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value that is cleared from the cache is not retrieved from the front cache
+	 */
+	result = libfcache_cache_empty(
+	          cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_front_cache_get_value_by_identifier(
+	          front_cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_front_cache_get_value_by_identifier(
+	          NULL,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_front_cache_get_value_by_identifier(
+	          front_cache,
+	          0,
+	          512,
+	          0,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_front_cache_free(
+	          &front_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "front_cache",
+	 front_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( front_cache != NULL )
+	{
+		libfcache_front_cache_free(
+		 &front_cache,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libfcache_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_front_cache_initialize",
+	 fcache_test_front_cache_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_front_cache_free",
+	 fcache_test_front_cache_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_front_cache_empty",
+	 fcache_test_front_cache_empty );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_front_cache_get_value_by_identifier",
+	 fcache_test_front_cache_get_value_by_identifier );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1387 @@
+/*
+ * Library greedy_dual type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_definitions.h"
+#include "../libfcache/libfcache_greedy_dual.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_greedy_dual_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_greedy_dual_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_greedy_dual_t *greedy_dual = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_greedy_dual_initialize(
+	          &greedy_dual,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->heap_size",
+	 greedy_dual->heap_size,
+	 0 );
+
+	result = libfcache_greedy_dual_free(
+	          &greedy_dual,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_greedy_dual_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	greedy_dual = (libfcache_greedy_dual_t *) 0x12345678UL;
+
+	result = libfcache_greedy_dual_initialize(
+	          &greedy_dual,
+	          8,
+	          &error );
+
+	greedy_dual = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_initialize(
+	          &greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( greedy_dual != NULL )
+	{
+		libfcache_greedy_dual_free(
+		 &greedy_dual,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_greedy_dual_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_greedy_dual_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_greedy_dual_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_greedy_dual_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_greedy_dual_clear(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_greedy_dual_t *greedy_dual = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_greedy_dual_initialize(
+	          &greedy_dual,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          0,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_insert_slot(
+	          greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_remove_slot(
+	          greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_greedy_dual_clear(
+	          greedy_dual,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->heap_size",
+	 greedy_dual->heap_size,
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "greedy_dual->inflation_value",
+	 greedy_dual->inflation_value,
+	 (uint64_t) 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->slots[ 0 ].heap_index",
+	 greedy_dual->slots[ 0 ].heap_index,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libfcache_greedy_dual_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_greedy_dual_free(
+	          &greedy_dual,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( greedy_dual != NULL )
+	{
+		libfcache_greedy_dual_free(
+		 &greedy_dual,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_greedy_dual_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_greedy_dual_resize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_greedy_dual_t *greedy_dual = NULL;
+	int result                           = 0;
+	int slot                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_greedy_dual_initialize(
+	          &greedy_dual,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( slot = 0;
+	     slot < 8;
+	     slot++ )
+	{
+		result = libfcache_greedy_dual_set_slot_cost(
+		          greedy_dual,
+		          slot,
+		          4096,
+		          (uint32_t) ( 8 - slot ),
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_greedy_dual_insert_slot(
+		          greedy_dual,
+		          slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 7 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_resize(
+	          greedy_dual,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->number_of_slots",
+	 greedy_dual->number_of_slots,
+	 4 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->heap_size",
+	 greedy_dual->heap_size,
+	 4 );
+
+	/* The slots that no longer fit are removed hence the victim is the remaining slot with the lowest cost
+	 */
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 3 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_resize(
+	          greedy_dual,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->number_of_slots",
+	 greedy_dual->number_of_slots,
+	 16 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->heap_size",
+	 greedy_dual->heap_size,
+	 4 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->slots[ 15 ].heap_index",
+	 greedy_dual->slots[ 15 ].heap_index,
+	 -1 );
+
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 3 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_greedy_dual_resize(
+	          NULL,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_resize(
+	          greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_greedy_dual_free(
+	          &greedy_dual,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( greedy_dual != NULL )
+	{
+		libfcache_greedy_dual_free(
+		 &greedy_dual,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_greedy_dual_set_slot_cost function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_greedy_dual_set_slot_cost(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_greedy_dual_t *greedy_dual = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_greedy_dual_initialize(
+	          &greedy_dual,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          0,
+	          4096,
+	          1000,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_SIZE(
+	 "greedy_dual->slots[ 0 ].value_size",
+	 greedy_dual->slots[ 0 ].value_size,
+	 (size_t) 4096 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "greedy_dual->slots[ 0 ].value_cost",
+	 greedy_dual->slots[ 0 ].value_cost,
+	 (uint32_t) 1000 );
+
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "greedy_dual->slots[ 0 ].value_cost",
+	 greedy_dual->slots[ 0 ].value_cost,
+	 (uint32_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfcache_greedy_dual_set_slot_cost(
+	          NULL,
+	          0,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          -1,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          8,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_greedy_dual_free(
+	          &greedy_dual,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( greedy_dual != NULL )
+	{
+		libfcache_greedy_dual_free(
+		 &greedy_dual,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_greedy_dual_get_victim_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_greedy_dual_get_victim_slot(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_greedy_dual_t *greedy_dual = NULL;
+	int result                           = 0;
+	int slot                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_greedy_dual_initialize(
+	          &greedy_dual,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* A cheap page, an expensive page and a cheap small value
+	 */
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          0,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_insert_slot(
+	          greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          1,
+	          4096,
+	          1000,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_insert_slot(
+	          greedy_dual,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          2,
+	          64,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_insert_slot(
+	          greedy_dual,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The victim is the slot with the lowest cost per byte
+	 */
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "greedy_dual->slots[ 0 ].priority",
+	 greedy_dual->slots[ 0 ].priority,
+	 (uint64_t) 4096 );
+
+	/* Removing the victim ages the remaining slots
+	 */
+	result = libfcache_greedy_dual_remove_slot(
+	          greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "greedy_dual->inflation_value",
+	 greedy_dual->inflation_value,
+	 (uint64_t) 4096 );
+
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_set_slot_cost(
+	          greedy_dual,
+	          0,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_insert_slot(
+	          greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "greedy_dual->slots[ 0 ].priority",
+	 greedy_dual->slots[ 0 ].priority,
+	 (uint64_t) 8192 );
+
+	/* A referenced slot has its frequency increased and its priority renewed
+	 */
+	result = libfcache_greedy_dual_reference_slot(
+	          greedy_dual,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "greedy_dual->slots[ 0 ].frequency",
+	 greedy_dual->slots[ 0 ].frequency,
+	 2 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "greedy_dual->slots[ 0 ].priority",
+	 greedy_dual->slots[ 0 ].priority,
+	 (uint64_t) 12288 );
+
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Removing a slot that is not the victim does not age the remaining slots
+	 */
+	result = libfcache_greedy_dual_remove_slot(
+	          greedy_dual,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT64(
+	 "greedy_dual->inflation_value",
+	 greedy_dual->inflation_value,
+	 (uint64_t) 4096 );
+
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Removing a slot that was already removed has no effect
+	 */
+	result = libfcache_greedy_dual_remove_slot(
+	          greedy_dual,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_reference_slot(
+	          greedy_dual,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "greedy_dual->heap_size",
+	 greedy_dual->heap_size,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfcache_greedy_dual_get_victim_slot(
+	          NULL,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_insert_slot(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_insert_slot(
+	          greedy_dual,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_reference_slot(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_reference_slot(
+	          greedy_dual,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_remove_slot(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_remove_slot(
+	          greedy_dual,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_greedy_dual_clear(
+	          greedy_dual,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_greedy_dual_get_victim_slot(
+	          greedy_dual,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_greedy_dual_free(
+	          &greedy_dual,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "greedy_dual",
+	 greedy_dual );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( greedy_dual != NULL )
+	{
+		libfcache_greedy_dual_free(
+		 &greedy_dual,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_greedy_dual_initialize",
+	 fcache_test_greedy_dual_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_greedy_dual_free",
+	 fcache_test_greedy_dual_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_greedy_dual_clear",
+	 fcache_test_greedy_dual_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_greedy_dual_resize",
+	 fcache_test_greedy_dual_resize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_greedy_dual_set_slot_cost",
+	 fcache_test_greedy_dual_set_slot_cost );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_greedy_dual_get_victim_slot",
+	 fcache_test_greedy_dual_get_victim_slot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
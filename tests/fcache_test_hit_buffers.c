@@ -0,0 +1,764 @@
+/*
+ * Library hit_buffers type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_definitions.h"
+#include "../libfcache/libfcache_hit_buffers.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_hit_buffers_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_hit_buffers_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_hit_buffers_t *hit_buffers = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_hit_buffers_initialize(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_hit_buffers_free(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_hit_buffers_initialize(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hit_buffers = (libfcache_hit_buffers_t *) 0x12345678UL;
+
+	result = libfcache_hit_buffers_initialize(
+	          &hit_buffers,
+	          &error );
+
+	hit_buffers = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hit_buffers != NULL )
+	{
+		libfcache_hit_buffers_free(
+		 &hit_buffers,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_hit_buffers_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_hit_buffers_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_hit_buffers_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_hit_buffers_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_hit_buffers_clear(
+     void )
+{
+	int slots[ LIBFCACHE_HIT_BUFFERS_BUFFER_SIZE ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_hit_buffers_t *hit_buffers = NULL;
+	int number_of_slots                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_hit_buffers_initialize(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_hit_buffers_append_slot(
+	          hit_buffers,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_hit_buffers_clear(
+	          hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_hit_buffers_remove_slots(
+	          hit_buffers,
+	          3 % LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS,
+	          slots,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_hit_buffers_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_hit_buffers_free(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hit_buffers != NULL )
+	{
+		libfcache_hit_buffers_free(
+		 &hit_buffers,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_hit_buffers_append_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_hit_buffers_append_slot(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_hit_buffers_t *hit_buffers = NULL;
+	int iterator                         = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_hit_buffers_initialize(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < LIBFCACHE_HIT_BUFFERS_BUFFER_SIZE;
+	     iterator++ )
+	{
+		result = libfcache_hit_buffers_append_slot(
+		          hit_buffers,
+		          5,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A hit is dropped when the hit buffer is full
+	 */
+	result = libfcache_hit_buffers_append_slot(
+	          hit_buffers,
+	          5,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A hit on a slot of another stripe is not affected by the full hit buffer
+	 */
+	result = libfcache_hit_buffers_append_slot(
+	          hit_buffers,
+	          6,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_hit_buffers_append_slot(
+	          NULL,
+	          5,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_hit_buffers_append_slot(
+	          hit_buffers,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_hit_buffers_free(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hit_buffers != NULL )
+	{
+		libfcache_hit_buffers_free(
+		 &hit_buffers,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_hit_buffers_remove_slots function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_hit_buffers_remove_slots(
+     void )
+{
+	int slots[ LIBFCACHE_HIT_BUFFERS_BUFFER_SIZE ];
+
+	libcerror_error_t *error             = NULL;
+	libfcache_hit_buffers_t *hit_buffers = NULL;
+	int number_of_slots                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_hit_buffers_initialize(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_hit_buffers_append_slot(
+	          hit_buffers,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_hit_buffers_append_slot(
+	          hit_buffers,
+	          3 + LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_hit_buffers_remove_slots(
+	          hit_buffers,
+	          3,
+	          slots,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slots[ 0 ]",
+	 slots[ 0 ],
+	 3 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slots[ 1 ]",
+	 slots[ 1 ],
+	 3 + LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS );
+
+	/* The hit buffer is empty after its slots were removed
+	 */
+	result = libfcache_hit_buffers_remove_slots(
+	          hit_buffers,
+	          3,
+	          slots,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slots",
+	 number_of_slots,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_hit_buffers_remove_slots(
+	          NULL,
+	          3,
+	          slots,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_hit_buffers_remove_slots(
+	          hit_buffers,
+	          -1,
+	          slots,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_hit_buffers_remove_slots(
+	          hit_buffers,
+	          LIBFCACHE_HIT_BUFFERS_NUMBER_OF_BUFFERS,
+	          slots,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_hit_buffers_remove_slots(
+	          hit_buffers,
+	          3,
+	          NULL,
+	          &number_of_slots,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_hit_buffers_remove_slots(
+	          hit_buffers,
+	          3,
+	          slots,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_hit_buffers_free(
+	          &hit_buffers,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "hit_buffers",
+	 hit_buffers );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hit_buffers != NULL )
+	{
+		libfcache_hit_buffers_free(
+		 &hit_buffers,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_hit_buffers_initialize",
+	 fcache_test_hit_buffers_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_hit_buffers_free",
+	 fcache_test_hit_buffers_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_hit_buffers_clear",
+	 fcache_test_hit_buffers_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_hit_buffers_append_slot",
+	 fcache_test_hit_buffers_append_slot );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_hit_buffers_remove_slots",
+	 fcache_test_hit_buffers_remove_slots );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1273 @@
+/*
+ * Library linear_table type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_linear_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_linear_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_linear_table_t *linear_table = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_free(
+	          &linear_table,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_linear_table_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	linear_table = (libfcache_linear_table_t *) 0x12345678UL;
+
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          16,
+	          &error );
+
+	linear_table = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linear_table != NULL )
+	{
+		libfcache_linear_table_free(
+		 &linear_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_linear_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_linear_table_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_linear_table_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_clear(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_linear_table_t *linear_table = NULL;
+	int result                             = 0;
+	int slot                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          3,
+	          1,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_linear_table_clear(
+	          linear_table,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          1,
+	          4096,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_linear_table_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_linear_table_free(
+	          &linear_table,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linear_table != NULL )
+	{
+		libfcache_linear_table_free(
+		 &linear_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_linear_table_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_resize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_linear_table_t *linear_table = NULL;
+	int result                             = 0;
+	int slot                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          3,
+	          1,
+	          4096,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          12,
+	          1,
+	          8192,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_linear_table_resize(
+	          linear_table,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          1,
+	          4096,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 3 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          1,
+	          8192,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_linear_table_resize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_linear_table_resize(
+	          linear_table,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_linear_table_free(
+	          &linear_table,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linear_table != NULL )
+	{
+		libfcache_linear_table_free(
+		 &linear_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_linear_table_get_group_match_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_get_group_match_mask(
+     void )
+{
+	off64_t offsets[ 4 ] = {
+		4096, 0x100000000LL, 4096, 0x100001000LL };
+
+	uint32_t mask = 0;
+
+	/* Test regular cases
+	 */
+	mask = libfcache_linear_table_get_group_match_mask(
+	        offsets,
+	        4096 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "mask",
+	 mask,
+	 (uint32_t) 0x00000005UL );
+
+	mask = libfcache_linear_table_get_group_match_mask(
+	        offsets,
+	        0x100001000LL );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "mask",
+	 mask,
+	 (uint32_t) 0x00000008UL );
+
+	/* Test that the upper 32-bit of the offsets are compared
+	 */
+	mask = libfcache_linear_table_get_group_match_mask(
+	        offsets,
+	        0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "mask",
+	 mask,
+	 (uint32_t) 0x00000000UL );
+
+	mask = libfcache_linear_table_get_group_match_mask(
+	        offsets,
+	        0x200001000LL );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT32(
+	 "mask",
+	 mask,
+	 (uint32_t) 0x00000000UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfcache_linear_table_get_slot_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_get_slot_by_identifier(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_linear_table_t *linear_table = NULL;
+	int result                             = 0;
+	int slot                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( slot = 0;
+	     slot < 16;
+	     slot++ )
+	{
+		result = libfcache_linear_table_insert_slot(
+		          linear_table,
+		          slot,
+		          slot % 2,
+		          (off64_t) slot * 512,
+		          1,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          1,
+	          7 * 512,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 7 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a different file index
+	 */
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          0,
+	          7 * 512,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a different timestamp
+	 */
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          1,
+	          7 * 512,
+	          2,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          NULL,
+	          1,
+	          7 * 512,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          1,
+	          7 * 512,
+	          1,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_linear_table_free(
+	          &linear_table,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linear_table != NULL )
+	{
+		libfcache_linear_table_free(
+		 &linear_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_linear_table_insert_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_insert_slot(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_linear_table_t *linear_table = NULL;
+	int result                             = 0;
+	int slot                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          5,
+	          0,
+	          1024,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting a slot that is already stored replaces its identifier
+	 */
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          5,
+	          0,
+	          2048,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          0,
+	          1024,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          0,
+	          2048,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 5 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting a slot with the identifier of another slot replaces the other slot
+	 */
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          7,
+	          0,
+	          2048,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          0,
+	          2048,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 7 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_linear_table_insert_slot(
+	          NULL,
+	          5,
+	          0,
+	          1024,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          -1,
+	          0,
+	          1024,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_linear_table_insert_slot(
+	          linear_table,
+	          16,
+	          0,
+	          1024,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_linear_table_free(
+	          &linear_table,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linear_table != NULL )
+	{
+		libfcache_linear_table_free(
+		 &linear_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_linear_table_remove_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_linear_table_remove_slot(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_linear_table_t *linear_table = NULL;
+	int result                             = 0;
+	int slot                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_linear_table_initialize(
+	          &linear_table,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( slot = 0;
+	     slot < 4;
+	     slot++ )
+	{
+		result = libfcache_linear_table_insert_slot(
+		          linear_table,
+		          slot,
+		          0,
+		          (off64_t) slot * 512,
+		          1,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfcache_linear_table_remove_slot(
+	          linear_table,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          0,
+	          2 * 512,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_linear_table_get_slot_by_identifier(
+	          linear_table,
+	          0,
+	          3 * 512,
+	          1,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 3 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test removing a slot that is not stored
+	 */
+	result = libfcache_linear_table_remove_slot(
+	          linear_table,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_linear_table_remove_slot(
+	          NULL,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_linear_table_remove_slot(
+	          linear_table,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_linear_table_free(
+	          &linear_table,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "linear_table",
+	 linear_table );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linear_table != NULL )
+	{
+		libfcache_linear_table_free(
+		 &linear_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_initialize",
+	 fcache_test_linear_table_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_free",
+	 fcache_test_linear_table_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_clear",
+	 fcache_test_linear_table_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_resize",
+	 fcache_test_linear_table_resize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_get_group_match_mask",
+	 fcache_test_linear_table_get_group_match_mask );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_get_slot_by_identifier",
+	 fcache_test_linear_table_get_slot_by_identifier );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_insert_slot",
+	 fcache_test_linear_table_insert_slot );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_linear_table_remove_slot",
+	 fcache_test_linear_table_remove_slot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,794 @@
+/*
+ * Library pending_loads type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_pending_loads.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_pending_load_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_pending_load_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_pending_load_t *pending_load = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_pending_load_initialize(
+	          &pending_load,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "pending_load",
+	 pending_load );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT64(
+	 "pending_load->offset",
+	 (int64_t) pending_load->offset,
+	 (int64_t) 512 );
+
+	result = libfcache_pending_load_free(
+	          &pending_load,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "pending_load",
+	 pending_load );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_pending_load_initialize(
+	          NULL,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pending_load = (libfcache_pending_load_t *) 0x12345678UL;
+
+	result = libfcache_pending_load_initialize(
+	          &pending_load,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	pending_load = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pending_load != NULL )
+	{
+		libfcache_pending_load_free(
+		 &pending_load,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_pending_load_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_pending_load_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_pending_load_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_pending_loads_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_pending_loads_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfcache_pending_loads_t *pending_loads = NULL;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_pending_loads_initialize(
+	          &pending_loads,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "pending_loads",
+	 pending_loads );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_pending_loads_free(
+	          &pending_loads,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "pending_loads",
+	 pending_loads );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_pending_loads_initialize(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pending_loads = (libfcache_pending_loads_t *) 0x12345678UL;
+
+	result = libfcache_pending_loads_initialize(
+	          &pending_loads,
+	          &error );
+
+	pending_loads = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pending_loads != NULL )
+	{
+		libfcache_pending_loads_free(
+		 &pending_loads,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_pending_loads_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_pending_loads_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_pending_loads_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_pending_loads_start_load function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_pending_loads_start_load(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfcache_cache_value_t *cache_value     = NULL;
+	libfcache_pending_load_t *pending_load   = NULL;
+	libfcache_pending_loads_t *pending_loads = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_pending_loads_initialize(
+	          &pending_loads,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "pending_loads",
+	 pending_loads );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_pending_loads_start_load(
+	          pending_loads,
+	          0,
+	          512,
+	          0,
+	          &pending_load,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "pending_load",
+	 pending_load );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "pending_loads->number_of_loads",
+	 pending_loads->number_of_loads,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfcache_pending_loads_start_load(
+	          NULL,
+	          0,
+	          1024,
+	          0,
+	          &pending_load,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_pending_loads_start_load(
+	          pending_loads,
+	          0,
+	          1024,
+	          0,
+	          NULL,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_pending_loads_start_load(
+	          pending_loads,
+	          0,
+	          1024,
+	          0,
+	          &pending_load,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_pending_loads_free(
+	          &pending_loads,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "pending_loads",
+	 pending_loads );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pending_loads != NULL )
+	{
+		libfcache_pending_loads_free(
+		 &pending_loads,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_pending_loads_finish_load function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_pending_loads_finish_load(
+     void )
+{
+	libfcache_pending_load_t unknown_load;
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_cache_value_t *cache_value     = NULL;
+	libfcache_pending_load_t *pending_load   = NULL;
+	libfcache_pending_loads_t *pending_loads = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_pending_loads_initialize(
+	          &pending_loads,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "pending_loads",
+	 pending_loads );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_pending_loads_start_load(
+	          pending_loads,
+	          0,
+	          512,
+	          0,
+	          &pending_load,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_pending_loads_finish_load(
+	          pending_loads,
+	          pending_load,
+	          (libfcache_cache_value_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "pending_loads->number_of_loads",
+	 pending_loads->number_of_loads,
+	 0 );
+
+	/* A value can be loaded again after the previous load finished
+	 */
+	result = libfcache_pending_loads_start_load(
+	          pending_loads,
+	          0,
+	          512,
+	          0,
+	          &pending_load,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "pending_load",
+	 pending_load );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_pending_loads_finish_load(
+	          pending_loads,
+	          pending_load,
+	          NULL,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_pending_loads_start_load(
+	          pending_loads,
+	          0,
+	          512,
+	          0,
+	          &pending_load,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_pending_loads_finish_load(
+	          NULL,
+	          pending_load,
+	          NULL,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_pending_loads_finish_load(
+	          pending_loads,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_pending_loads_finish_load(
+	          pending_loads,
+	          pending_load,
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a pending load that is not part of the pending loads
+	 */
+	result = libfcache_pending_loads_finish_load(
+	          pending_loads,
+	          &unknown_load,
+	          NULL,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_pending_loads_free(
+	          &pending_loads,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "pending_loads",
+	 pending_loads );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pending_loads != NULL )
+	{
+		libfcache_pending_loads_free(
+		 &pending_loads,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_pending_load_initialize",
+	 fcache_test_pending_load_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_pending_load_free",
+	 fcache_test_pending_load_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_pending_loads_initialize",
+	 fcache_test_pending_loads_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_pending_loads_free",
+	 fcache_test_pending_loads_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_pending_loads_start_load",
+	 fcache_test_pending_loads_start_load );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_pending_loads_finish_load",
+	 fcache_test_pending_loads_finish_load );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1137 @@
+/*
+ * Library policy type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_memory.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_policy.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+typedef struct fcache_test_policy_data fcache_test_policy_data_t;
+
+/* Round-robin test policy data
+ */
+struct fcache_test_policy_data
+{
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The next victim slot
+	 */
+	int next_slot;
+
+	/* The number of inserted slots
+	 */
+	int number_of_inserts;
+
+	/* The number of referenced slots
+	 */
+	int number_of_references;
+
+	/* The number of removed slots
+	 */
+	int number_of_removes;
+};
+
+/* Frees test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_free(
+     intptr_t **policy_data,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( policy_data == NULL )
+	{
+		return( -1 );
+	}
+	if( *policy_data != NULL )
+	{
+		memory_free(
+		 *policy_data );
+
+		*policy_data = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_clone(
+     intptr_t **destination_policy_data,
+     intptr_t *source_policy_data,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	fcache_test_policy_data_t *test_policy_data = NULL;
+
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( destination_policy_data == NULL )
+	 || ( source_policy_data == NULL ) )
+	{
+		return( -1 );
+	}
+	test_policy_data = memory_allocate_structure(
+	                    fcache_test_policy_data_t );
+
+	if( test_policy_data == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     test_policy_data,
+	     source_policy_data,
+	     sizeof( fcache_test_policy_data_t ) ) == NULL )
+	{
+		memory_free(
+		 test_policy_data );
+
+		return( -1 );
+	}
+	*destination_policy_data = (intptr_t *) test_policy_data;
+
+	return( 1 );
+}
+
+/* Clears test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_clear(
+     intptr_t *policy_data,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	fcache_test_policy_data_t *test_policy_data = NULL;
+
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( policy_data == NULL )
+	{
+		return( -1 );
+	}
+	test_policy_data = (fcache_test_policy_data_t *) policy_data;
+
+	test_policy_data->next_slot            = 0;
+	test_policy_data->number_of_inserts    = 0;
+	test_policy_data->number_of_references = 0;
+	test_policy_data->number_of_removes    = 0;
+
+	return( 1 );
+}
+
+/* Resizes test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_resize(
+     intptr_t *policy_data,
+     int number_of_slots,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	fcache_test_policy_data_t *test_policy_data = NULL;
+
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( policy_data == NULL )
+	 || ( number_of_slots <= 0 ) )
+	{
+		return( -1 );
+	}
+	test_policy_data = (fcache_test_policy_data_t *) policy_data;
+
+	test_policy_data->number_of_slots = number_of_slots;
+	test_policy_data->next_slot       = 0;
+
+	return( 1 );
+}
+
+/* Inserts a slot into test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_insert_slot(
+     intptr_t *policy_data,
+     int slot FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int file_index FCACHE_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int64_t timestamp FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( slot )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( file_index )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( offset )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( timestamp )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( policy_data == NULL )
+	{
+		return( -1 );
+	}
+	( (fcache_test_policy_data_t *) policy_data )->number_of_inserts += 1;
+
+	return( 1 );
+}
+
+/* References a slot in test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_reference_slot(
+     intptr_t *policy_data,
+     int slot FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( slot )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( policy_data == NULL )
+	{
+		return( -1 );
+	}
+	( (fcache_test_policy_data_t *) policy_data )->number_of_references += 1;
+
+	return( 1 );
+}
+
+/* Removes a slot from test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_remove_slot(
+     intptr_t *policy_data,
+     int slot FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int file_index FCACHE_TEST_ATTRIBUTE_UNUSED,
+     off64_t offset FCACHE_TEST_ATTRIBUTE_UNUSED,
+     int64_t timestamp FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( slot )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( file_index )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( offset )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( timestamp )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( policy_data == NULL )
+	{
+		return( -1 );
+	}
+	( (fcache_test_policy_data_t *) policy_data )->number_of_removes += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the victim slot from test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_data_get_victim_slot(
+     intptr_t *policy_data,
+     int *slot,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	fcache_test_policy_data_t *test_policy_data = NULL;
+
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( policy_data == NULL )
+	 || ( slot == NULL ) )
+	{
+		return( -1 );
+	}
+	test_policy_data = (fcache_test_policy_data_t *) policy_data;
+
+	*slot = test_policy_data->next_slot;
+
+	test_policy_data->next_slot = ( test_policy_data->next_slot + 1 ) % test_policy_data->number_of_slots;
+
+	return( 1 );
+}
+
+/* Creates a policy with test policy data
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_policy_initialize_test_policy(
+     libfcache_policy_t **policy,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	fcache_test_policy_data_t *test_policy_data = NULL;
+
+	test_policy_data = memory_allocate_structure(
+	                    fcache_test_policy_data_t );
+
+	if( test_policy_data == NULL )
+	{
+		return( -1 );
+	}
+	test_policy_data->number_of_slots      = number_of_slots;
+	test_policy_data->next_slot            = 0;
+	test_policy_data->number_of_inserts    = 0;
+	test_policy_data->number_of_references = 0;
+	test_policy_data->number_of_removes    = 0;
+
+	if( libfcache_policy_initialize(
+	     policy,
+	     (intptr_t *) test_policy_data,
+	     &fcache_test_policy_data_free,
+	     &fcache_test_policy_data_clone,
+	     &fcache_test_policy_data_clear,
+	     &fcache_test_policy_data_resize,
+	     &fcache_test_policy_data_insert_slot,
+	     &fcache_test_policy_data_reference_slot,
+	     &fcache_test_policy_data_remove_slot,
+	     &fcache_test_policy_data_get_victim_slot,
+	     error ) != 1 )
+	{
+		memory_free(
+		 test_policy_data );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfcache_policy_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_policy_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfcache_policy_t *policy = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = fcache_test_policy_initialize_test_policy(
+	          &policy,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "policy",
+	 policy );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_policy_free(
+	          &policy,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "policy",
+	 policy );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_policy_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_policy_data_clear,
+	          &fcache_test_policy_data_resize,
+	          &fcache_test_policy_data_insert_slot,
+	          &fcache_test_policy_data_reference_slot,
+	          &fcache_test_policy_data_remove_slot,
+	          &fcache_test_policy_data_get_victim_slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	policy = (libfcache_policy_t *) 0x12345678UL;
+
+	result = libfcache_policy_initialize(
+	          &policy,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_policy_data_clear,
+	          &fcache_test_policy_data_resize,
+	          &fcache_test_policy_data_insert_slot,
+	          &fcache_test_policy_data_reference_slot,
+	          &fcache_test_policy_data_remove_slot,
+	          &fcache_test_policy_data_get_victim_slot,
+	          &error );
+
+	policy = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_policy_initialize(
+	          &policy,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_policy_data_clear,
+	          &fcache_test_policy_data_resize,
+	          &fcache_test_policy_data_insert_slot,
+	          &fcache_test_policy_data_reference_slot,
+	          &fcache_test_policy_data_remove_slot,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+
+	/* Test libfcache_policy_initialize with malloc failing
+	 */
+	fcache_test_malloc_attempts_before_fail = 0;
+
+	result = libfcache_policy_initialize(
+	          &policy,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &fcache_test_policy_data_clear,
+	          &fcache_test_policy_data_resize,
+	          &fcache_test_policy_data_insert_slot,
+	          &fcache_test_policy_data_reference_slot,
+	          &fcache_test_policy_data_remove_slot,
+	          &fcache_test_policy_data_get_victim_slot,
+	          &error );
+
+	if( fcache_test_malloc_attempts_before_fail != -1 )
+	{
+		fcache_test_malloc_attempts_before_fail = -1;
+
+		if( policy != NULL )
+		{
+			libfcache_policy_free(
+			 &policy,
+			 NULL );
+		}
+	}
+	else
+	{
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "policy",
+		 policy );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( policy != NULL )
+	{
+		libfcache_policy_free(
+		 &policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_policy_initialize_clock, libfcache_policy_initialize_two_queue
+ * and libfcache_policy_initialize_s3_fifo functions
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_policy_initialize_built_in(
+     void )
+{
+	int (*initialize_functions[ 3 ])(
+	       libfcache_policy_t **policy,
+	       int number_of_slots,
+	       libcerror_error_t **error ) = {
+		&libfcache_policy_initialize_clock,
+		&libfcache_policy_initialize_two_queue,
+		&libfcache_policy_initialize_s3_fifo };
+
+	libcerror_error_t *error               = NULL;
+	libfcache_policy_t *destination_policy = NULL;
+	libfcache_policy_t *policy             = NULL;
+	int function_index                     = 0;
+	int result                             = 0;
+	int slot                               = -1;
+
+	for( function_index = 0;
+	     function_index < 3;
+	     function_index++ )
+	{
+		/* Test regular cases
+		 */
+		result = initialize_functions[ function_index ](
+		          &policy,
+		          4,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "policy",
+		 policy );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_policy_insert_slot(
+		          policy,
+		          0,
+		          0,
+		          0,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The only inserted slot is the victim
+		 */
+		result = libfcache_policy_get_victim_slot(
+		          policy,
+		          &slot,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "slot",
+		 slot,
+		 0 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_policy_reference_slot(
+		          policy,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_policy_remove_slot(
+		          policy,
+		          slot,
+		          0,
+		          0,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A built-in policy cannot be cloned
+		 */
+		result = libfcache_policy_clone(
+		          &destination_policy,
+		          policy,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "destination_policy",
+		 destination_policy );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfcache_policy_free(
+		          &policy,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "policy",
+		 policy );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = initialize_functions[ function_index ](
+		          NULL,
+		          4,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = initialize_functions[ function_index ](
+		          &policy,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "policy",
+		 policy );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( policy != NULL )
+	{
+		libfcache_policy_free(
+		 &policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_policy_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_policy_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_policy_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_policy_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_policy_clone(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcache_policy_t *destination_policy = NULL;
+	libfcache_policy_t *source_policy      = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fcache_test_policy_initialize_test_policy(
+	          &source_policy,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "source_policy",
+	 source_policy );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_policy_reference_slot(
+	          source_policy,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_policy_clone(
+	          &destination_policy,
+	          source_policy,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_policy",
+	 destination_policy );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The policy data of the destination is cleared but keeps its size
+	 */
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "destination_policy->policy_data->number_of_slots",
+	 ( (fcache_test_policy_data_t *) destination_policy->policy_data )->number_of_slots,
+	 8 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "destination_policy->policy_data->number_of_references",
+	 ( (fcache_test_policy_data_t *) destination_policy->policy_data )->number_of_references,
+	 0 );
+
+	result = libfcache_policy_free(
+	          &destination_policy,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_policy_clone(
+	          &destination_policy,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "destination_policy",
+	 destination_policy );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_policy_clone(
+	          NULL,
+	          source_policy,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_policy = (libfcache_policy_t *) 0x12345678UL;
+
+	result = libfcache_policy_clone(
+	          &destination_policy,
+	          source_policy,
+	          &error );
+
+	destination_policy = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_policy_free(
+	          &source_policy,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_policy != NULL )
+	{
+		libfcache_policy_free(
+		 &destination_policy,
+		 NULL );
+	}
+	if( source_policy != NULL )
+	{
+		libfcache_policy_free(
+		 &source_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_policy_get_victim_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_policy_get_victim_slot(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfcache_policy_t *policy = NULL;
+	int result                 = 0;
+	int slot                   = 0;
+
+	/* Initialize test
+	 */
+	result = fcache_test_policy_initialize_test_policy(
+	          &policy,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "policy",
+	 policy );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_policy_get_victim_slot(
+	          policy,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_policy_get_victim_slot(
+	          policy,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_policy_get_victim_slot(
+	          NULL,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_policy_get_victim_slot(
+	          policy,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_policy_free(
+	          &policy,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( policy != NULL )
+	{
+		libfcache_policy_free(
+		 &policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_policy_initialize",
+	 fcache_test_policy_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_policy_initialize_built_in",
+	 fcache_test_policy_initialize_built_in );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_policy_free",
+	 fcache_test_policy_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_policy_clone",
+	 fcache_test_policy_clone );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_policy_get_victim_slot",
+	 fcache_test_policy_get_victim_slot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,1055 @@
+/*
+ * Library s3_fifo type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_definitions.h"
+#include "../libfcache/libfcache_s3_fifo.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_s3_fifo_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_s3_fifo_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfcache_s3_fifo_t *s3_fifo = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_s3_fifo_initialize(
+	          &s3_fifo,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_free(
+	          &s3_fifo,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_s3_fifo_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	s3_fifo = (libfcache_s3_fifo_t *) 0x12345678UL;
+
+	result = libfcache_s3_fifo_initialize(
+	          &s3_fifo,
+	          8,
+	          &error );
+
+	s3_fifo = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_s3_fifo_initialize(
+	          &s3_fifo,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( s3_fifo != NULL )
+	{
+		libfcache_s3_fifo_free(
+		 &s3_fifo,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_s3_fifo_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_s3_fifo_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_s3_fifo_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_s3_fifo_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_s3_fifo_clear(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfcache_s3_fifo_t *s3_fifo = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_s3_fifo_initialize(
+	          &s3_fifo,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_insert_slot(
+	          s3_fifo,
+	          3,
+	          0,
+	          3 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_evict_slot(
+	          s3_fifo,
+	          3,
+	          0,
+	          3 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_s3_fifo_clear(
+	          s3_fifo,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The ghost table was cleared so the identifier is inserted in the small queue
+	 */
+	result = libfcache_s3_fifo_insert_slot(
+	          s3_fifo,
+	          3,
+	          0,
+	          3 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->slot_queues->queue_numbers[ 3 ]",
+	 s3_fifo->slot_queues->queue_numbers[ 3 ],
+	 LIBFCACHE_S3_FIFO_QUEUE_SMALL );
+
+	/* Test error cases
+	 */
+	result = libfcache_s3_fifo_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_s3_fifo_free(
+	          &s3_fifo,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( s3_fifo != NULL )
+	{
+		libfcache_s3_fifo_free(
+		 &s3_fifo,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_s3_fifo_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_s3_fifo_resize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfcache_s3_fifo_t *s3_fifo = NULL;
+	int result                   = 0;
+	int slot                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_s3_fifo_initialize(
+	          &s3_fifo,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_insert_slot(
+	          s3_fifo,
+	          7,
+	          0,
+	          7 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_insert_slot(
+	          s3_fifo,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_s3_fifo_resize(
+	          s3_fifo,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "s3_fifo->slot_queues->queue_sizes[ LIBFCACHE_S3_FIFO_QUEUE_SMALL - 1 ]",
+	 s3_fifo->slot_queues->queue_sizes[ LIBFCACHE_S3_FIFO_QUEUE_SMALL - 1 ],
+	 1 );
+
+	result = libfcache_s3_fifo_get_victim_slot(
+	          s3_fifo,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_resize(
+	          s3_fifo,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->slot_queues->queue_numbers[ 15 ]",
+	 s3_fifo->slot_queues->queue_numbers[ 15 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcache_s3_fifo_resize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_s3_fifo_resize(
+	          s3_fifo,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_s3_fifo_free(
+	          &s3_fifo,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( s3_fifo != NULL )
+	{
+		libfcache_s3_fifo_free(
+		 &s3_fifo,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_s3_fifo_get_victim_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_s3_fifo_get_victim_slot(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfcache_s3_fifo_t *s3_fifo = NULL;
+	int result                   = 0;
+	int slot                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_s3_fifo_initialize(
+	          &s3_fifo,
+	          20,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( slot = 0;
+	     slot < 4;
+	     slot++ )
+	{
+		result = libfcache_s3_fifo_insert_slot(
+		          s3_fifo,
+		          slot,
+		          0,
+		          (off64_t) slot * 512,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_s3_fifo_reference_slot(
+	          s3_fifo,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_reference_slot(
+	          s3_fifo,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_reference_slot(
+	          s3_fifo,
+	          1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The small queue reached its maximum size of 2 slots, its oldest slot was referenced
+	 * twice and is moved to the main queue, the next oldest slot was referenced once and is the victim
+	 */
+	result = libfcache_s3_fifo_get_victim_slot(
+	          s3_fifo,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->slot_queues->queue_numbers[ 0 ]",
+	 s3_fifo->slot_queues->queue_numbers[ 0 ],
+	 LIBFCACHE_S3_FIFO_QUEUE_MAIN );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->frequencies[ 0 ]",
+	 s3_fifo->frequencies[ 0 ],
+	 0 );
+
+	/* An identifier evicted from the small queue is inserted in the main queue when it returns
+	 */
+	result = libfcache_s3_fifo_evict_slot(
+	          s3_fifo,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_insert_slot(
+	          s3_fifo,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->slot_queues->queue_numbers[ 1 ]",
+	 s3_fifo->slot_queues->queue_numbers[ 1 ],
+	 LIBFCACHE_S3_FIFO_QUEUE_MAIN );
+
+	result = libfcache_s3_fifo_get_victim_slot(
+	          s3_fifo,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_evict_slot(
+	          s3_fifo,
+	          2,
+	          0,
+	          2 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The small queue is within its maximum size hence a slot of the main queue is the victim,
+	 * the referenced oldest slot of the main queue is reinserted with a decreased frequency
+	 */
+	result = libfcache_s3_fifo_reference_slot(
+	          s3_fifo,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_get_victim_slot(
+	          s3_fifo,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->frequencies[ 0 ]",
+	 s3_fifo->frequencies[ 0 ],
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->slot_queues->queue_numbers[ 0 ]",
+	 s3_fifo->slot_queues->queue_numbers[ 0 ],
+	 LIBFCACHE_S3_FIFO_QUEUE_MAIN );
+
+	/* The frequency of a slot does not exceed its maximum
+	 */
+	for( slot = 0;
+	     slot < 5;
+	     slot++ )
+	{
+		result = libfcache_s3_fifo_reference_slot(
+		          s3_fifo,
+		          3,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "s3_fifo->frequencies[ 3 ]",
+	 s3_fifo->frequencies[ 3 ],
+	 LIBFCACHE_S3_FIFO_MAXIMUM_FREQUENCY );
+
+	/* A removed slot is reused first
+	 */
+	result = libfcache_s3_fifo_remove_slot(
+	          s3_fifo,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_s3_fifo_get_victim_slot(
+	          s3_fifo,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 3 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_s3_fifo_get_victim_slot(
+	          NULL,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_s3_fifo_get_victim_slot(
+	          s3_fifo,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_s3_fifo_insert_slot(
+	          s3_fifo,
+	          20,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_s3_fifo_reference_slot(
+	          s3_fifo,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_s3_fifo_remove_slot(
+	          s3_fifo,
+	          20,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_s3_fifo_evict_slot(
+	          s3_fifo,
+	          20,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_s3_fifo_free(
+	          &s3_fifo,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "s3_fifo",
+	 s3_fifo );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( s3_fifo != NULL )
+	{
+		libfcache_s3_fifo_free(
+		 &s3_fifo,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_s3_fifo_initialize",
+	 fcache_test_s3_fifo_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_s3_fifo_free",
+	 fcache_test_s3_fifo_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_s3_fifo_clear",
+	 fcache_test_s3_fifo_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_s3_fifo_resize",
+	 fcache_test_s3_fifo_resize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_s3_fifo_get_victim_slot",
+	 fcache_test_s3_fifo_get_victim_slot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
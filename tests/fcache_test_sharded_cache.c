@@ -0,0 +1,2548 @@
+/*
+ * Library sharded cache type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_memory.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_sharded_cache.h"
+
+/* Test value free function
+ * Returns 1 if successful or -1 on error
+ */
+int fcache_test_sharded_cache_value_free_function(
+     intptr_t **value FCACHE_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( value )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* The number of cache values after which the test iterate callback function stops the iteration
+ */
+int fcache_test_sharded_cache_iterate_maximum_number_of_values = 0;
+
+/* Test iterate callback function
+ * Counts the cache values in callback_data
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fcache_test_sharded_cache_iterate_callback_function(
+     libfcache_cache_value_t *cache_value FCACHE_TEST_ATTRIBUTE_UNUSED,
+     intptr_t *callback_data,
+     libcerror_error_t **error FCACHE_TEST_ATTRIBUTE_UNUSED )
+{
+	int *number_of_values = NULL;
+
+	FCACHE_TEST_UNREFERENCED_PARAMETER( cache_value )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( error )
+
+	number_of_values = (int *) callback_data;
+
+	*number_of_values += 1;
+
+	if( ( fcache_test_sharded_cache_iterate_maximum_number_of_values != 0 )
+	 && ( *number_of_values >= fcache_test_sharded_cache_iterate_maximum_number_of_values ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfcache_sharded_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int number_of_shards                     = 0;
+	int result                               = 0;
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 3;
+	int number_of_memset_fail_tests          = 2;
+	int test_number                          = 0;
+#endif
+
+	/* Test libfcache_sharded_cache_initialize with a specific number of shards
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfcache_sharded_cache_initialize with the default number of shards
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          0,
+	          LIBFCACHE_CACHE_FLAG_CLOCK_REPLACEMENT,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_number_of_shards(
+	          sharded_cache,
+	          &number_of_shards,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_shards",
+	 number_of_shards,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfcache_sharded_cache_initialize with more shards than cache entries
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          2,
+	          8,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_number_of_shards(
+	          sharded_cache,
+	          &number_of_shards,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_shards",
+	 number_of_shards,
+	 2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          NULL,
+	          64,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sharded_cache = (libfcache_sharded_cache_t *) 0x12345678UL;
+
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          4,
+	          0,
+	          &error );
+
+	sharded_cache = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          -1,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          -1,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          4,
+	          0xff,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCACHE_TEST_MEMORY )
+
+	/* 1 fail in memory_allocate_structure
+	 * 2 fail in memory_allocate of shards
+	 * 3 fail in libfcache_cache_initialize_with_flags
+	 */
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcache_sharded_cache_initialize with malloc failing
+		 */
+		fcache_test_malloc_attempts_before_fail = test_number;
+
+		result = libfcache_sharded_cache_initialize(
+		          &sharded_cache,
+		          64,
+		          4,
+		          0,
+		          &error );
+
+		if( fcache_test_malloc_attempts_before_fail != -1 )
+		{
+			fcache_test_malloc_attempts_before_fail = -1;
+
+			if( sharded_cache != NULL )
+			{
+				libfcache_sharded_cache_free(
+				 &sharded_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "sharded_cache",
+			 sharded_cache );
+
+			FCACHE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* 1 fail in memset after memory_allocate_structure
+	 * 2 fail in memset after memory_allocate of shards
+	 */
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcache_sharded_cache_initialize with memset failing
+		 */
+		fcache_test_memset_attempts_before_fail = test_number;
+
+		result = libfcache_sharded_cache_initialize(
+		          &sharded_cache,
+		          64,
+		          4,
+		          0,
+		          &error );
+
+		if( fcache_test_memset_attempts_before_fail != -1 )
+		{
+			fcache_test_memset_attempts_before_fail = -1;
+
+			if( sharded_cache != NULL )
+			{
+				libfcache_sharded_cache_free(
+				 &sharded_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCACHE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCACHE_TEST_ASSERT_IS_NULL(
+			 "sharded_cache",
+			 sharded_cache );
+
+			FCACHE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FCACHE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_empty(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int number_of_cache_values               = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          16,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_sharded_cache_empty(
+	          sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_number_of_cache_values(
+	          sharded_cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_empty(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_invalidate_file function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_invalidate_file(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	libfcache_cache_value_t *cache_value     = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          16,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          1,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_sharded_cache_invalidate_file(
+	          sharded_cache,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          1,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_invalidate_file(
+	          NULL,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_invalidate_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_invalidate_range(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	libfcache_cache_value_t *cache_value     = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          16,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          1,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_sharded_cache_invalidate_range(
+	          sharded_cache,
+	          0,
+	          512,
+	          512,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          1,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_invalidate_range(
+	          NULL,
+	          0,
+	          512,
+	          512,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_iterate_values_in_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_iterate_values_in_range(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int number_of_values                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          16,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          1,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	fcache_test_sharded_cache_iterate_maximum_number_of_values = 0;
+	number_of_values                                           = 0;
+
+	result = libfcache_sharded_cache_iterate_values_in_range(
+	          sharded_cache,
+	          0,
+	          0,
+	          1024,
+	          &fcache_test_sharded_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping the iteration
+	 */
+	fcache_test_sharded_cache_iterate_maximum_number_of_values = 1;
+	number_of_values                                           = 0;
+
+	result = libfcache_sharded_cache_iterate_values_in_range(
+	          sharded_cache,
+	          0,
+	          0,
+	          1024,
+	          &fcache_test_sharded_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fcache_test_sharded_cache_iterate_maximum_number_of_values = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_iterate_values_in_range(
+	          NULL,
+	          0,
+	          0,
+	          1024,
+	          &fcache_test_sharded_cache_iterate_callback_function,
+	          (intptr_t *) &number_of_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_get_number_of_shards function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_get_number_of_shards(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int number_of_shards                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_sharded_cache_get_number_of_shards(
+	          sharded_cache,
+	          &number_of_shards,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_shards",
+	 number_of_shards,
+	 4 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_get_number_of_shards(
+	          NULL,
+	          &number_of_shards,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_get_number_of_shards(
+	          sharded_cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_get_number_of_cache_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_get_number_of_cache_values(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int number_of_cache_values               = 0;
+	int result                               = 0;
+	int value_index                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_sharded_cache_get_number_of_cache_values(
+	          sharded_cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache values are spread over the shards, 8 values do not fill any shard
+	 */
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		result = libfcache_sharded_cache_set_value_by_identifier(
+		          sharded_cache,
+		          0,
+		          (off64_t) value_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_sharded_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_sharded_cache_get_number_of_cache_values(
+	          sharded_cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 8 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_get_number_of_cache_values(
+	          NULL,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_get_number_of_cache_values(
+	          sharded_cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_get_value_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_get_value_by_identifier(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_cache_value_t *cache_value     = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	intptr_t *value                          = NULL;
+	int result                               = 0;
+	int value_index                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		result = libfcache_sharded_cache_set_value_by_identifier(
+		          sharded_cache,
+		          value_index % 2,
+		          (off64_t) value_index * 512,
+		          0,
+		          (intptr_t *) &( value_data[ value_index ] ),
+		          &fcache_test_sharded_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		result = libfcache_sharded_cache_get_value_by_identifier(
+		          sharded_cache,
+		          value_index % 2,
+		          (off64_t) value_index * 512,
+		          0,
+		          &cache_value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NOT_NULL(
+		 "cache_value",
+		 cache_value );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcache_cache_value_get_value(
+		          cache_value,
+		          &value,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_EQUAL_INTPTR(
+		 "value",
+		 value,
+		 (intptr_t *) &( value_data[ value_index ] ) );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test with an identifier that is not in the cache
+	 */
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          1,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a timestamp that does not match
+	 */
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          1,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_get_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_set_value_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_set_value_by_identifier(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int number_of_cache_values               = 0;
+	int result                               = 0;
+	int value_index                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          16,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier_with_size(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          16,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier_with_cost(
+	          sharded_cache,
+	          0,
+	          1024,
+	          0,
+	          (intptr_t *) value_data,
+	          16,
+	          4,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the number of cache values does not exceed the maximum
+	 */
+	for( value_index = 0;
+	     value_index < 256;
+	     value_index++ )
+	{
+		result = libfcache_sharded_cache_set_value_by_identifier(
+		          sharded_cache,
+		          1,
+		          (off64_t) value_index * 512,
+		          0,
+		          (intptr_t *) value_data,
+		          &fcache_test_sharded_cache_value_free_function,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcache_sharded_cache_get_number_of_cache_values(
+	          sharded_cache,
+	          &number_of_cache_values,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_values",
+	 number_of_cache_values,
+	 16 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier_with_size(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          16,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier_with_cost(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          (intptr_t *) value_data,
+	          16,
+	          4,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_sharded_cache_acquire_value_by_identifier and libfcache_sharded_cache_release_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_acquire_value_by_identifier(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_cache_value_t *cache_value     = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          16,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_set_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          (intptr_t *) value_data,
+	          &fcache_test_sharded_cache_value_free_function,
+	          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_sharded_cache_acquire_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_sharded_cache_release_value(
+	          sharded_cache,
+	          cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an identifier that is not in the cache
+	 */
+	result = libfcache_sharded_cache_acquire_value_by_identifier(
+	          sharded_cache,
+	          0,
+	          1024,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_sharded_cache_acquire_value_by_identifier(
+	          NULL,
+	          0,
+	          512,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_release_value(
+	          NULL,
+	          cache_value,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_sharded_cache_release_value(
+	          sharded_cache,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+/* The number of threads and iterations of the multi-threading test
+ */
+#define FCACHE_TEST_SHARDED_CACHE_NUMBER_OF_THREADS	4
+#define FCACHE_TEST_SHARDED_CACHE_NUMBER_OF_ITERATIONS	4096
+
+/* The value data of the multi-threading test
+ */
+uint8_t fcache_test_sharded_cache_thread_value_data[ 16 ];
+
+/* Sets and retrieves cache values from a thread
+ * Returns NULL if successful or a non-NULL value if not
+ */
+void *fcache_test_sharded_cache_thread_function(
+       void *arguments )
+{
+	libfcache_cache_value_t *cache_value     = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	int iteration                            = 0;
+	int number_of_cache_values               = 0;
+	int result                               = 0;
+
+	sharded_cache = (libfcache_sharded_cache_t *) arguments;
+
+	for( iteration = 0;
+	     iteration < FCACHE_TEST_SHARDED_CACHE_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		result = libfcache_sharded_cache_get_value_by_identifier(
+		          sharded_cache,
+		          0,
+		          (off64_t) ( iteration % 256 ),
+		          0,
+		          &cache_value,
+		          NULL );
+
+		if( result == -1 )
+		{
+			return( arguments );
+		}
+		else if( result == 0 )
+		{
+			result = libfcache_sharded_cache_set_value_by_identifier(
+			          sharded_cache,
+			          0,
+			          (off64_t) ( iteration % 256 ),
+			          0,
+			          (intptr_t *) fcache_test_sharded_cache_thread_value_data,
+			          &fcache_test_sharded_cache_value_free_function,
+			          LIBFCACHE_CACHE_VALUE_FLAG_NON_MANAGED,
+			          NULL );
+
+			if( result != 1 )
+			{
+				return( arguments );
+			}
+		}
+		result = libfcache_sharded_cache_get_number_of_cache_values(
+		          sharded_cache,
+		          &number_of_cache_values,
+		          NULL );
+
+		if( ( result != 1 )
+		 || ( number_of_cache_values > 64 ) )
+		{
+			return( arguments );
+		}
+	}
+	return( NULL );
+}
+
+/* Tests the sharded cache functions from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_sharded_cache_multi_thread(
+     void )
+{
+	pthread_t threads[ FCACHE_TEST_SHARDED_CACHE_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error                 = NULL;
+	libfcache_sharded_cache_t *sharded_cache = NULL;
+	void *thread_result                      = NULL;
+	int number_of_threads                    = 0;
+	int result                               = 0;
+	int thread_index                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_sharded_cache_initialize(
+	          &sharded_cache,
+	          64,
+	          4,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < FCACHE_TEST_SHARDED_CACHE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &fcache_test_sharded_cache_thread_function,
+		          (void *) sharded_cache );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_threads++;
+	}
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		result = pthread_join(
+		          threads[ number_of_threads ],
+		          &thread_result );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "thread_result",
+		 thread_result );
+	}
+	/* Clean up
+	 */
+	result = libfcache_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libfcache_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_initialize",
+	 fcache_test_sharded_cache_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_free",
+	 fcache_test_sharded_cache_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_empty",
+	 fcache_test_sharded_cache_empty );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_invalidate_file",
+	 fcache_test_sharded_cache_invalidate_file );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_invalidate_range",
+	 fcache_test_sharded_cache_invalidate_range );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_iterate_values_in_range",
+	 fcache_test_sharded_cache_iterate_values_in_range );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_get_number_of_shards",
+	 fcache_test_sharded_cache_get_number_of_shards );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_get_number_of_cache_values",
+	 fcache_test_sharded_cache_get_number_of_cache_values );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_get_value_by_identifier",
+	 fcache_test_sharded_cache_get_value_by_identifier );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_set_value_by_identifier",
+	 fcache_test_sharded_cache_set_value_by_identifier );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache_acquire_value_by_identifier",
+	 fcache_test_sharded_cache_acquire_value_by_identifier );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_sharded_cache multi-threading",
+	 fcache_test_sharded_cache_multi_thread );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
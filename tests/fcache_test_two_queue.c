@@ -0,0 +1,1093 @@
+/*
+ * Library two_queue type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcache_test_libcerror.h"
+#include "fcache_test_libfcache.h"
+#include "fcache_test_macros.h"
+#include "fcache_test_unused.h"
+
+#include "../libfcache/libfcache_definitions.h"
+#include "../libfcache/libfcache_two_queue.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+/* Tests the libfcache_two_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_two_queue_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfcache_two_queue_t *two_queue = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcache_two_queue_initialize(
+	          &two_queue,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_free(
+	          &two_queue,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcache_two_queue_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	two_queue = (libfcache_two_queue_t *) 0x12345678UL;
+
+	result = libfcache_two_queue_initialize(
+	          &two_queue,
+	          8,
+	          &error );
+
+	two_queue = NULL;
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_two_queue_initialize(
+	          &two_queue,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( two_queue != NULL )
+	{
+		libfcache_two_queue_free(
+		 &two_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_two_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_two_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcache_two_queue_free(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_two_queue_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_two_queue_clear(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfcache_two_queue_t *two_queue = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_two_queue_initialize(
+	          &two_queue,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          3,
+	          0,
+	          3 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_evict_slot(
+	          two_queue,
+	          3,
+	          0,
+	          3 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_two_queue_clear(
+	          two_queue,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The ghost table was cleared so the identifier is inserted in the in queue
+	 */
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          3,
+	          0,
+	          3 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "two_queue->slot_queues->queue_numbers[ 3 ]",
+	 two_queue->slot_queues->queue_numbers[ 3 ],
+	 LIBFCACHE_TWO_QUEUE_TYPE_IN );
+
+	/* Test error cases
+	 */
+	result = libfcache_two_queue_clear(
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_two_queue_free(
+	          &two_queue,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( two_queue != NULL )
+	{
+		libfcache_two_queue_free(
+		 &two_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_two_queue_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_two_queue_resize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfcache_two_queue_t *two_queue = NULL;
+	int result                       = 0;
+	int slot                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_two_queue_initialize(
+	          &two_queue,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          7,
+	          0,
+	          7 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcache_two_queue_resize(
+	          two_queue,
+	          4,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "two_queue->slot_queues->queue_sizes[ LIBFCACHE_TWO_QUEUE_TYPE_IN - 1 ]",
+	 two_queue->slot_queues->queue_sizes[ LIBFCACHE_TWO_QUEUE_TYPE_IN - 1 ],
+	 1 );
+
+	result = libfcache_two_queue_get_victim_slot(
+	          two_queue,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_resize(
+	          two_queue,
+	          16,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "two_queue->slot_queues->queue_numbers[ 15 ]",
+	 two_queue->slot_queues->queue_numbers[ 15 ],
+	 LIBFCACHE_TWO_QUEUE_TYPE_NONE );
+
+	/* Test error cases
+	 */
+	result = libfcache_two_queue_resize(
+	          NULL,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_two_queue_resize(
+	          two_queue,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_two_queue_free(
+	          &two_queue,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( two_queue != NULL )
+	{
+		libfcache_two_queue_free(
+		 &two_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcache_two_queue_get_victim_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fcache_test_two_queue_get_victim_slot(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfcache_two_queue_t *two_queue = NULL;
+	int result                       = 0;
+	int slot                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_two_queue_initialize(
+	          &two_queue,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( slot = 0;
+	     slot < 4;
+	     slot++ )
+	{
+		result = libfcache_two_queue_insert_slot(
+		          two_queue,
+		          slot,
+		          0,
+		          (off64_t) slot * 512,
+		          0,
+		          &error );
+
+		FCACHE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCACHE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The in queue exceeds its maximum size of 2 slots hence its oldest slot is the victim
+	 */
+	result = libfcache_two_queue_get_victim_slot(
+	          two_queue,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A removed slot is reused first
+	 */
+	result = libfcache_two_queue_remove_slot(
+	          two_queue,
+	          2,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_get_victim_slot(
+	          two_queue,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 2 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An identifier evicted from the in queue is inserted in the main queue when it returns
+	 */
+	result = libfcache_two_queue_evict_slot(
+	          two_queue,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "two_queue->slot_queues->queue_numbers[ 0 ]",
+	 two_queue->slot_queues->queue_numbers[ 0 ],
+	 LIBFCACHE_TWO_QUEUE_TYPE_MAIN );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          2,
+	          0,
+	          2 * 512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "two_queue->slot_queues->queue_numbers[ 2 ]",
+	 two_queue->slot_queues->queue_numbers[ 2 ],
+	 LIBFCACHE_TWO_QUEUE_TYPE_IN );
+
+	result = libfcache_two_queue_get_victim_slot(
+	          two_queue,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_evict_slot(
+	          two_queue,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "two_queue->slot_queues->queue_numbers[ 1 ]",
+	 two_queue->slot_queues->queue_numbers[ 1 ],
+	 LIBFCACHE_TWO_QUEUE_TYPE_MAIN );
+
+	/* The in queue is within its maximum size hence the least recently used slot of the main queue is the victim
+	 */
+	result = libfcache_two_queue_get_victim_slot(
+	          two_queue,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 0 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A reference moves the slot to the front of the main queue
+	 */
+	result = libfcache_two_queue_reference_slot(
+	          two_queue,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_get_victim_slot(
+	          two_queue,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "slot",
+	 slot,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A slot in the in queue remains in FIFO order when referenced
+	 */
+	result = libfcache_two_queue_reference_slot(
+	          two_queue,
+	          3,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "two_queue->slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_IN - 1 ]",
+	 two_queue->slot_queues->last_slots[ LIBFCACHE_TWO_QUEUE_TYPE_IN - 1 ],
+	 3 );
+
+	/* An identifier evicted from the main queue is not remembered
+	 */
+	result = libfcache_two_queue_evict_slot(
+	          two_queue,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCACHE_TEST_ASSERT_EQUAL_UINT8(
+	 "two_queue->slot_queues->queue_numbers[ 1 ]",
+	 two_queue->slot_queues->queue_numbers[ 1 ],
+	 LIBFCACHE_TWO_QUEUE_TYPE_IN );
+
+	/* Test error cases
+	 */
+	result = libfcache_two_queue_get_victim_slot(
+	          NULL,
+	          &slot,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_two_queue_get_victim_slot(
+	          two_queue,
+	          NULL,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_two_queue_insert_slot(
+	          two_queue,
+	          8,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_two_queue_reference_slot(
+	          two_queue,
+	          -1,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_two_queue_remove_slot(
+	          two_queue,
+	          8,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcache_two_queue_evict_slot(
+	          two_queue,
+	          8,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCACHE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_two_queue_free(
+	          &two_queue,
+	          &error );
+
+	FCACHE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "two_queue",
+	 two_queue );
+
+	FCACHE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( two_queue != NULL )
+	{
+		libfcache_two_queue_free(
+		 &two_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCACHE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCACHE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argc )
+	FCACHE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT )
+
+	FCACHE_TEST_RUN(
+	 "libfcache_two_queue_initialize",
+	 fcache_test_two_queue_initialize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_two_queue_free",
+	 fcache_test_two_queue_free );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_two_queue_clear",
+	 fcache_test_two_queue_clear );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_two_queue_resize",
+	 fcache_test_two_queue_resize );
+
+	FCACHE_TEST_RUN(
+	 "libfcache_two_queue_get_victim_slot",
+	 fcache_test_two_queue_get_victim_slot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCACHE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
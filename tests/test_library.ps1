@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "cache cache_value date_time error support"
+$LibraryTests = "cache cache_value clock date_time error file_slots flat_table frequency_sketch front_cache greedy_dual hash_table hit_buffers linear_table pending_loads policy s3_fifo sharded_cache slot_queues support two_queue"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 